@@ -5,6 +5,7 @@
 #include <cmath>
 #include <concepts>
 #include <type_traits>
+#include <utility>
 
 #include "Error.h"
 #include "TypeTraits.h"
@@ -80,7 +81,7 @@ namespace hyperion::concepts {
 	/// @brief Concept that requires `T` to be constructible from the parameter pack `Args`
 	template<typename T, typename... Args>
 	concept ConstructibleFrom = requires(Args&&... args) {
-		T{args...};
+		T{std::forward<Args>(args)...};
 	};
 
 	/// @brief Concept that requires `T` and `U` to be the same type
@@ -17,6 +17,7 @@
 #include "Monads.h"
 #include "RingBuffer.h"
 #include "Span.h"
+#include "StaticRingBuffer.h"
 #include "TypeTraits.h"
 
 using hyperion::Err;  // NOLINT
@@ -1,12 +1,23 @@
 /// @brief This is a Lock-Free Single-ended Queue implementation using contiguous memory allocations
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <memory>
+#include <stop_token>
 #include <system_error>
+#include <tuple>
 
 #include "BasicTypes.h"
 #include "Macros.h"
 #include "Monads.h"
 #include "RingBuffer.h"
+#include "Span.h"
+#include "detail/ElementStorage.h"
+#include "synchronization/EventCount.h"
 
 namespace hyperion {
 
@@ -133,12 +144,28 @@ namespace hyperion {
 		OverwriteWhenFull = 1
 	};
 
+	/// @brief The concurrency model backing a `LockFreeQueue`
+	enum class QueueConcurrency : usize
+	{
+		/// @brief Backed by a thread-safe `RingBuffer`.
+		/// Checking for available space/entries and pushing/reading are separate steps, so
+		/// concurrent producers can overshoot `Capacity` and concurrent consumers can race
+		RingBuffer = 0,
+		/// @brief Bounded multi-producer, multi-consumer queue using per-slot turn counters.
+		/// Every `push`/`read` is linearizable
+		MPMC = 1,
+		/// @brief Bounded single-producer, single-consumer queue.
+		/// At most one thread may push and at most one thread may read at any given time
+		SPSC = 2
+	};
+
 	/// @brief The default capacityfor `LockFreeQueue`
 	static constexpr usize DEFAULT_QUEUE_CAPACITY = 512_usize;
 
 	template<typename T,
 			 QueuePolicy Policy = QueuePolicy::ErrWhenFull,
-			 usize Capacity = DEFAULT_QUEUE_CAPACITY>
+			 usize Capacity = DEFAULT_QUEUE_CAPACITY,
+			 QueueConcurrency Concurrency = QueueConcurrency::RingBuffer>
 	class LockFreeQueue {
 	  public:
 		constexpr LockFreeQueue() noexcept = default;
@@ -150,6 +177,7 @@ namespace hyperion {
 		requires Copyable<T> &&(Policy == QueuePolicy::ErrWhenFull) {
 			const auto pusher = [&]() {
 				m_data.push_back(entry);
+				m_pushed.notify_all();
 				return Ok(true);
 			};
 
@@ -165,6 +193,7 @@ namespace hyperion {
 		requires(Policy == QueuePolicy::ErrWhenFull) {
 			const auto pusher = [&]() {
 				m_data.push_back(std::forward<T>(entry));
+				m_pushed.notify_all();
 				return Ok(true);
 			};
 
@@ -182,6 +211,7 @@ namespace hyperion {
 		requires(Policy == QueuePolicy::ErrWhenFull) {
 			const auto pusher = [&]() {
 				m_data.emplace_back(std::forward<Args>(args)...);
+				m_pushed.notify_all();
 				return Ok(true);
 			};
 
@@ -196,11 +226,13 @@ namespace hyperion {
 		inline auto push(const T& entry) noexcept
 			-> void requires Copyable<T> &&(Policy == QueuePolicy::OverwriteWhenFull) {
 			m_data.push_back(entry);
+			m_pushed.notify_all();
 		}
 
 		inline auto
 		push(T&& entry) noexcept -> void requires(Policy == QueuePolicy::OverwriteWhenFull) {
 			m_data.push_back(std::forward<T>(entry));
+			m_pushed.notify_all();
 		}
 
 		template<typename... Args>
@@ -208,15 +240,40 @@ namespace hyperion {
 		inline auto
 		push(Args&&... args) noexcept -> void requires(Policy == QueuePolicy::OverwriteWhenFull) {
 			m_data.emplace_back(std::forward<Args>(args)...);
+			m_pushed.notify_all();
 		}
 
+		/// @brief Removes the oldest entry in the queue and returns it
+		///
+		/// @return The oldest entry in the queue, or `QueueIsEmpty` if the queue was empty
 		[[nodiscard]] inline auto read() noexcept -> Result<T, LockFreeQueueError> {
-			if(empty()) {
-				return Err(LockFreeQueueError(LockFreeQueueErrorType::QueueIsEmpty));
+			auto entry = m_data.pop_front();
+			if(entry.is_some()) {
+				m_popped.notify_all();
 			}
-			else {
-				return Ok(*(m_data.pop_back()));
+			return entry.ok_or_else(
+				[]() { return LockFreeQueueError(LockFreeQueueErrorType::QueueIsEmpty); });
+		}
+
+		/// @brief Removes up to `entries.size()` of the oldest entries in the queue, moving them
+		/// into `entries` in the order they were pushed
+		///
+		/// @param entries - The span to move the removed entries into
+		///
+		/// @return The number of entries read
+		[[nodiscard]] inline auto read_n(Span<T> entries) noexcept -> usize {
+			const auto num_read = static_cast<usize>(m_data.pop_front_n(entries));
+			if(num_read != 0_usize) {
+				m_popped.notify_all();
 			}
+			return num_read;
+		}
+
+		/// @brief Returns the number of entries in the queue at some point during the call
+		///
+		/// @return The number of entries in the queue
+		[[nodiscard]] inline auto size() const noexcept -> usize {
+			return m_data.size();
 		}
 
 		[[nodiscard]] inline auto empty() const noexcept -> bool {
@@ -227,12 +284,613 @@ namespace hyperion {
 			return m_data.size() == Capacity;
 		}
 
+		/// @brief Blocks until the queue has entries to read or `stop` is requested
+		///
+		/// @param stop - The stop token to also wake up on
+		inline auto wait_for_entries(const std::stop_token& stop) noexcept -> void {
+			m_pushed.wait_until([this]() { return !empty(); }, stop);
+		}
+
+		/// @brief Blocks until the queue has entries to read, `stop` is requested, or `timeout`
+		/// elapses
+		///
+		/// @param stop - The stop token to also wake up on
+		/// @param timeout - The longest to wait for
+		///
+		/// @return Whether the queue has entries to read or `stop` was requested
+		template<typename Rep, typename Period>
+		[[nodiscard]] inline auto
+		wait_for_entries(const std::stop_token& stop,
+						 std::chrono::duration<Rep, Period> timeout) noexcept -> bool {
+			return m_pushed.wait_for([this]() { return !empty(); }, stop, timeout);
+		}
+
+		/// @brief Blocks until the queue has room for another entry
+		inline auto wait_for_space() noexcept -> void {
+			m_popped.wait_until([this]() { return !full(); });
+		}
+
+		/// @brief Blocks until the queue has room for another entry, or `timeout` elapses
+		///
+		/// @param timeout - The longest to wait for
+		///
+		/// @return Whether the queue has room for another entry
+		template<typename Rep, typename Period>
+		[[nodiscard]] inline auto
+		wait_for_space(std::chrono::duration<Rep, Period> timeout) noexcept -> bool {
+			return m_popped.wait_for([this]() { return !full(); }, timeout);
+		}
+
+		/// @brief Blocks until every entry in the queue has been read
+		inline auto wait_until_empty() noexcept -> void {
+			m_popped.wait_until([this]() { return empty(); });
+		}
+
 		constexpr auto operator=(const LockFreeQueue& queue) noexcept -> LockFreeQueue& = default;
 		constexpr auto operator=(LockFreeQueue&& queue) noexcept -> LockFreeQueue& = default;
 
 	  private:
 		RingBuffer<T, RingBufferType::ThreadSafe> m_data
 			= RingBuffer<T, RingBufferType::ThreadSafe>(Capacity);
+		utils::EventCount m_pushed = utils::EventCount();
+		utils::EventCount m_popped = utils::EventCount();
+	};
+
+	/// @brief Bounded multi-producer, multi-consumer `LockFreeQueue`.
+	///
+	/// Each slot carries a turn counter (its sequence number) recording whether it is ready to be
+	/// written to or read from for a given position in the queue. Producers and consumers claim
+	/// positions with a single compare-and-swap on their respective index and then only touch the
+	/// claimed slot, so `try_push` and `try_pop` are linearizable and never overshoot the
+	/// capacity of the queue.
+	///
+	/// The slots are stored inline, since the capacity is known at compile time, so the queue
+	/// doesn't allocate and reaching a slot doesn't go through a pointer to separate storage.
+	/// A slot's storage is uninitialized until an entry is constructed in it by the push that
+	/// claims it, and the entry is destroyed by the read that claims it, so `T` doesn't need to
+	/// be default constructible.
+	///
+	/// @tparam T - The type to store in the queue
+	/// @tparam Policy - What to do when the queue is full
+	/// @tparam Capacity - The minimum capacity of the queue. Rounded up to a power of two
+	template<typename T, QueuePolicy Policy, usize Capacity>
+	class LockFreeQueue<T, Policy, Capacity, QueueConcurrency::MPMC> {
+	  public:
+		/// @brief The actual capacity of the queue
+		static constexpr usize CAPACITY = std::bit_ceil(Capacity);
+
+		LockFreeQueue() noexcept {
+			for(auto i = 0_usize; i < CAPACITY; ++i) {
+				m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+		LockFreeQueue(const LockFreeQueue& queue) = delete;
+		LockFreeQueue(LockFreeQueue&& queue) = delete;
+		~LockFreeQueue() noexcept {
+			const auto write = m_write_position.load(std::memory_order_acquire);
+			for(auto position = m_read_position.load(std::memory_order_acquire); position != write;
+				++position)
+			{
+				std::destroy_at(m_slots[position & MASK].pointer());
+			}
+		}
+
+		/// @brief Attempts to push the given entry onto the end of the queue
+		///
+		/// @param entry - The entry to push
+		///
+		/// @return Whether the entry was pushed. `false` if the queue was full
+		[[nodiscard]] inline auto try_push(const T& entry) noexcept -> bool requires Copyable<T> {
+			return try_emplace(entry);
+		}
+
+		/// @brief Attempts to push the given entry onto the end of the queue
+		///
+		/// @param entry - The entry to push
+		///
+		/// @return Whether the entry was pushed. `false` if the queue was full
+		[[nodiscard]] inline auto try_push(T&& entry) noexcept -> bool {
+			return try_emplace(std::forward<T>(entry));
+		}
+
+		/// @brief Attempts to construct an entry in place at the end of the queue.
+		/// `args` are only consumed if the entry was pushed
+		///
+		/// @param args - The arguments to construct the entry with
+		///
+		/// @return Whether the entry was pushed. `false` if the queue was full
+		template<typename... Args>
+		requires ConstructibleFrom<T, Args...>
+		[[nodiscard]] inline auto try_emplace(Args&&... args) noexcept -> bool {
+			auto position = m_write_position.load(std::memory_order_relaxed);
+			while(true) {
+				auto& slot = m_slots[position & MASK];
+				const auto sequence = slot.m_sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<i64>(sequence - position);
+
+				if(difference == 0) {
+					if(m_write_position.compare_exchange_weak(position,
+															  position + 1,
+															  std::memory_order_relaxed))
+					{
+						std::construct_at(slot.pointer(), std::forward<Args>(args)...);
+						slot.m_sequence.store(position + 1, std::memory_order_release);
+						m_pushed.notify_all();
+						return true;
+					}
+				}
+				else if(difference < 0) {
+					return false;
+				}
+				else {
+					position = m_write_position.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/// @brief Attempts to remove the entry at the front of the queue
+		///
+		/// @return The entry at the front of the queue, or `None` if the queue was empty
+		[[nodiscard]] inline auto try_pop() noexcept -> Option<T> {
+			auto position = m_read_position.load(std::memory_order_relaxed);
+			while(true) {
+				auto& slot = m_slots[position & MASK];
+				const auto sequence = slot.m_sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<i64>(sequence - (position + 1));
+
+				if(difference == 0) {
+					if(m_read_position.compare_exchange_weak(position,
+															 position + 1,
+															 std::memory_order_relaxed))
+					{
+						auto value = std::move(slot.value());
+						std::destroy_at(slot.pointer());
+						slot.m_sequence.store(position + CAPACITY, std::memory_order_release);
+						m_popped.notify_all();
+						return Some(std::move(value));
+					}
+				}
+				else if(difference < 0) {
+					return None();
+				}
+				else {
+					position = m_read_position.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		[[nodiscard]] inline auto push(const T& entry) noexcept -> Result<bool, LockFreeQueueError>
+		requires Copyable<T> &&(Policy == QueuePolicy::ErrWhenFull) {
+			return push_or_err(entry);
+		}
+
+		[[nodiscard]] inline auto push(T&& entry) noexcept -> Result<bool, LockFreeQueueError>
+		requires(Policy == QueuePolicy::ErrWhenFull) {
+			return push_or_err(std::forward<T>(entry));
+		}
+
+		template<typename... Args>
+		requires ConstructibleFrom<T, Args...>
+		[[nodiscard]] inline auto push(Args&&... args) noexcept -> Result<bool, LockFreeQueueError>
+		requires(Policy == QueuePolicy::ErrWhenFull) {
+			return push_or_err(std::forward<Args>(args)...);
+		}
+
+		inline auto push(const T& entry) noexcept
+			-> void requires Copyable<T> &&(Policy == QueuePolicy::OverwriteWhenFull) {
+			push_overwriting(entry);
+		}
+
+		inline auto
+		push(T&& entry) noexcept -> void requires(Policy == QueuePolicy::OverwriteWhenFull) {
+			push_overwriting(std::forward<T>(entry));
+		}
+
+		template<typename... Args>
+		requires ConstructibleFrom<T, Args...>
+		inline auto
+		push(Args&&... args) noexcept -> void requires(Policy == QueuePolicy::OverwriteWhenFull) {
+			push_overwriting(std::forward<Args>(args)...);
+		}
+
+		[[nodiscard]] inline auto read() noexcept -> Result<T, LockFreeQueueError> {
+			return try_pop().ok_or_else(
+				[]() { return LockFreeQueueError(LockFreeQueueErrorType::QueueIsEmpty); });
+		}
+
+		/// @brief Removes up to `entries.size()` entries from the front of the queue, moving them
+		/// into `entries` in the order they were pushed
+		///
+		/// The run of ready entries is claimed with a single compare-and-swap on the read
+		/// position, instead of one per entry
+		///
+		/// @param entries - The span to move the removed entries into
+		///
+		/// @return The number of entries read
+		[[nodiscard]] inline auto read_n(Span<T> entries) noexcept -> usize {
+			auto position = m_read_position.load(std::memory_order_relaxed);
+			while(true) {
+				auto num_ready = 0_usize;
+				while(num_ready < entries.size()) {
+					const auto& slot = m_slots[(position + num_ready) & MASK];
+					if(slot.m_sequence.load(std::memory_order_acquire) != position + num_ready + 1) {
+						break;
+					}
+					++num_ready;
+				}
+
+				if(num_ready == 0_usize) {
+					const auto current = m_read_position.load(std::memory_order_relaxed);
+					if(current == position) {
+						return 0_usize;
+					}
+					position = current;
+				}
+				else if(m_read_position.compare_exchange_weak(position,
+															  position + num_ready,
+															  std::memory_order_relaxed))
+				{
+					for(auto i = 0_usize; i < num_ready; ++i) {
+						auto& slot = m_slots[(position + i) & MASK];
+						entries[i] = std::move(slot.value());
+						std::destroy_at(slot.pointer());
+						slot.m_sequence.store(position + i + CAPACITY, std::memory_order_release);
+					}
+					m_popped.notify_all();
+					return num_ready;
+				}
+			}
+		}
+
+		/// @brief Returns the number of entries in the queue at some point during the call
+		///
+		/// @return The number of entries in the queue
+		[[nodiscard]] inline auto size() const noexcept -> usize {
+			const auto read = m_read_position.load(std::memory_order_relaxed);
+			const auto write = m_write_position.load(std::memory_order_relaxed);
+			return write > read ? std::min(write - read, CAPACITY) : 0_usize;
+		}
+
+		[[nodiscard]] inline auto empty() const noexcept -> bool {
+			return size() == 0_usize;
+		}
+
+		[[nodiscard]] inline auto full() const noexcept -> bool {
+			return size() == CAPACITY;
+		}
+
+		/// @brief Blocks until the queue has entries to read or `stop` is requested
+		///
+		/// @param stop - The stop token to also wake up on
+		inline auto wait_for_entries(const std::stop_token& stop) noexcept -> void {
+			m_pushed.wait_until([this]() { return !empty(); }, stop);
+		}
+
+		/// @brief Blocks until the queue has entries to read, `stop` is requested, or `timeout`
+		/// elapses
+		///
+		/// @param stop - The stop token to also wake up on
+		/// @param timeout - The longest to wait for
+		///
+		/// @return Whether the queue has entries to read or `stop` was requested
+		template<typename Rep, typename Period>
+		[[nodiscard]] inline auto
+		wait_for_entries(const std::stop_token& stop,
+						 std::chrono::duration<Rep, Period> timeout) noexcept -> bool {
+			return m_pushed.wait_for([this]() { return !empty(); }, stop, timeout);
+		}
+
+		/// @brief Blocks until the queue has room for another entry
+		inline auto wait_for_space() noexcept -> void {
+			m_popped.wait_until([this]() { return !full(); });
+		}
+
+		/// @brief Blocks until the queue has room for another entry, or `timeout` elapses
+		///
+		/// @param timeout - The longest to wait for
+		///
+		/// @return Whether the queue has room for another entry
+		template<typename Rep, typename Period>
+		[[nodiscard]] inline auto
+		wait_for_space(std::chrono::duration<Rep, Period> timeout) noexcept -> bool {
+			return m_popped.wait_for([this]() { return !full(); }, timeout);
+		}
+
+		/// @brief Blocks until every entry in the queue has been read
+		inline auto wait_until_empty() noexcept -> void {
+			m_popped.wait_until([this]() { return empty(); });
+		}
+
+		auto operator=(const LockFreeQueue& queue) -> LockFreeQueue& = delete;
+		auto operator=(LockFreeQueue&& queue) -> LockFreeQueue& = delete;
+
+	  private:
+		static constexpr usize MASK = CAPACITY - 1;
+
+		struct alignas(CACHE_LINE_SIZE) Slot : detail::ElementStorage<T> {
+			std::atomic<usize> m_sequence = 0_usize;
+		};
+
+		alignas(CACHE_LINE_SIZE) std::atomic<usize> m_write_position = 0_usize;
+		alignas(CACHE_LINE_SIZE) std::atomic<usize> m_read_position = 0_usize;
+		std::array<Slot, CAPACITY> m_slots = {};
+		alignas(CACHE_LINE_SIZE) utils::EventCount m_pushed = utils::EventCount();
+		alignas(CACHE_LINE_SIZE) utils::EventCount m_popped = utils::EventCount();
+
+		template<typename... Args>
+		[[nodiscard]] inline auto
+		push_or_err(Args&&... args) noexcept -> Result<bool, LockFreeQueueError> {
+			if(try_emplace(std::forward<Args>(args)...)) {
+				return Ok(true);
+			}
+
+			return Err(LockFreeQueueError(LockFreeQueueErrorType::QueueIsFull));
+		}
+
+		template<typename... Args>
+		inline auto push_overwriting(Args&&... args) noexcept -> void {
+			while(!try_emplace(std::forward<Args>(args)...)) {
+				std::ignore = try_pop();
+			}
+		}
+	};
+
+	/// @brief Bounded single-producer, single-consumer `LockFreeQueue`.
+	///
+	/// The producer and consumer each own one index, kept on separate cache lines alongside a
+	/// cached copy of the other side's index. The other side's index is only re-loaded when the
+	/// cached copy says the queue is full (for the producer) or empty (for the consumer), and
+	/// indices are only ever published with release stores, so the common case of `try_push` and
+	/// `try_pop` doesn't touch any shared cache line or perform any read-modify-write operation.
+	///
+	/// At most one thread may push and at most one thread may read at any given time.
+	/// Because the producer can't discard entries without racing the consumer, only
+	/// `QueuePolicy::ErrWhenFull` is supported.
+	///
+	/// Waking a blocked thread needs a full fence, so pushing and reading don't wake the other
+	/// side themselves. A producer whose consumer may be blocked in `wait_for_entries` must call
+	/// `notify_pushed` after pushing, and a consumer whose producer may be blocked in
+	/// `wait_for_space` or `wait_until_empty` must call `notify_popped` after reading. Callers
+	/// can do this once per batch, or not at all if the other side waits somewhere else.
+	///
+	/// Like the multi-producer, multi-consumer queue, the entries are stored inline, and only
+	/// constructed while they're in the queue.
+	///
+	/// @tparam T - The type to store in the queue
+	/// @tparam Policy - What to do when the queue is full. Must be `QueuePolicy::ErrWhenFull`
+	/// @tparam Capacity - The minimum capacity of the queue. Rounded up to a power of two
+	template<typename T, QueuePolicy Policy, usize Capacity>
+	class LockFreeQueue<T, Policy, Capacity, QueueConcurrency::SPSC> {
+	  public:
+		static_assert(Policy == QueuePolicy::ErrWhenFull,
+					  "A single-producer, single-consumer LockFreeQueue only supports "
+					  "QueuePolicy::ErrWhenFull");
+
+		/// @brief The actual capacity of the queue
+		static constexpr usize CAPACITY = std::bit_ceil(Capacity);
+
+		LockFreeQueue() noexcept = default;
+		LockFreeQueue(const LockFreeQueue& queue) = delete;
+		LockFreeQueue(LockFreeQueue&& queue) = delete;
+		~LockFreeQueue() noexcept {
+			const auto write = m_write_position.load(std::memory_order_acquire);
+			for(auto position = m_read_position.load(std::memory_order_acquire); position != write;
+				++position)
+			{
+				std::destroy_at(m_entries[position & MASK].pointer());
+			}
+		}
+
+		/// @brief Attempts to push the given entry onto the end of the queue.
+		/// Must only be called from the producer thread
+		///
+		/// @param entry - The entry to push
+		///
+		/// @return Whether the entry was pushed. `false` if the queue was full
+		[[nodiscard]] inline auto try_push(const T& entry) noexcept -> bool requires Copyable<T> {
+			return try_emplace(entry);
+		}
+
+		/// @brief Attempts to push the given entry onto the end of the queue.
+		/// Must only be called from the producer thread
+		///
+		/// @param entry - The entry to push
+		///
+		/// @return Whether the entry was pushed. `false` if the queue was full
+		[[nodiscard]] inline auto try_push(T&& entry) noexcept -> bool {
+			return try_emplace(std::forward<T>(entry));
+		}
+
+		/// @brief Attempts to construct an entry in place at the end of the queue.
+		/// `args` are only consumed if the entry was pushed.
+		/// Must only be called from the producer thread
+		///
+		/// @param args - The arguments to construct the entry with
+		///
+		/// @return Whether the entry was pushed. `false` if the queue was full
+		template<typename... Args>
+		requires ConstructibleFrom<T, Args...>
+		[[nodiscard]] inline auto try_emplace(Args&&... args) noexcept -> bool {
+			const auto position = m_write_position.load(std::memory_order_relaxed);
+			if(position - m_cached_read_position == CAPACITY) {
+				m_cached_read_position = m_read_position.load(std::memory_order_acquire);
+				if(position - m_cached_read_position == CAPACITY) {
+					return false;
+				}
+			}
+
+			std::construct_at(m_entries[position & MASK].pointer(), std::forward<Args>(args)...);
+			m_write_position.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// @brief Attempts to remove the entry at the front of the queue.
+		/// Must only be called from the consumer thread
+		///
+		/// @return The entry at the front of the queue, or `None` if the queue was empty
+		[[nodiscard]] inline auto try_pop() noexcept -> Option<T> {
+			const auto position = m_read_position.load(std::memory_order_relaxed);
+			if(position == m_cached_write_position) {
+				m_cached_write_position = m_write_position.load(std::memory_order_acquire);
+				if(position == m_cached_write_position) {
+					return None();
+				}
+			}
+
+			auto& entry = m_entries[position & MASK];
+			auto value = std::move(entry.value());
+			std::destroy_at(entry.pointer());
+			m_read_position.store(position + 1, std::memory_order_release);
+			return Some(std::move(value));
+		}
+
+		[[nodiscard]] inline auto push(const T& entry) noexcept -> Result<bool, LockFreeQueueError>
+		requires Copyable<T> {
+			return push_or_err(entry);
+		}
+
+		[[nodiscard]] inline auto push(T&& entry) noexcept -> Result<bool, LockFreeQueueError> {
+			return push_or_err(std::forward<T>(entry));
+		}
+
+		template<typename... Args>
+		requires ConstructibleFrom<T, Args...>
+		[[nodiscard]] inline auto push(Args&&... args) noexcept -> Result<bool, LockFreeQueueError> {
+			return push_or_err(std::forward<Args>(args)...);
+		}
+
+		[[nodiscard]] inline auto read() noexcept -> Result<T, LockFreeQueueError> {
+			return try_pop().ok_or_else(
+				[]() { return LockFreeQueueError(LockFreeQueueErrorType::QueueIsEmpty); });
+		}
+
+		/// @brief Removes up to `entries.size()` entries from the front of the queue, moving them
+		/// into `entries` in the order they were pushed.
+		/// Must only be called from the consumer thread
+		///
+		/// @param entries - The span to move the removed entries into
+		///
+		/// @return The number of entries read
+		[[nodiscard]] inline auto read_n(Span<T> entries) noexcept -> usize {
+			const auto position = m_read_position.load(std::memory_order_relaxed);
+			if(m_cached_write_position - position < entries.size()) {
+				m_cached_write_position = m_write_position.load(std::memory_order_acquire);
+			}
+
+			const auto num_read = std::min(m_cached_write_position - position, entries.size());
+			for(auto i = 0_usize; i < num_read; ++i) {
+				auto& entry = m_entries[(position + i) & MASK];
+				entries[i] = std::move(entry.value());
+				std::destroy_at(entry.pointer());
+			}
+			if(num_read != 0_usize) {
+				m_read_position.store(position + num_read, std::memory_order_release);
+			}
+			return num_read;
+		}
+
+		/// @brief Returns the number of entries in the queue at some point during the call
+		///
+		/// @return The number of entries in the queue
+		[[nodiscard]] inline auto size() const noexcept -> usize {
+			const auto read = m_read_position.load(std::memory_order_acquire);
+			const auto write = m_write_position.load(std::memory_order_acquire);
+			return write > read ? std::min(write - read, CAPACITY) : 0_usize;
+		}
+
+		[[nodiscard]] inline auto empty() const noexcept -> bool {
+			return size() == 0_usize;
+		}
+
+		[[nodiscard]] inline auto full() const noexcept -> bool {
+			return size() == CAPACITY;
+		}
+
+		/// @brief Wakes the consumer if it's blocked in `wait_for_entries`.
+		/// Must only be called from the producer thread, after pushing
+		inline auto notify_pushed() noexcept -> void {
+			m_pushed.notify_all();
+		}
+
+		/// @brief Wakes the producer if it's blocked in `wait_for_space` or `wait_until_empty`.
+		/// Must only be called from the consumer thread, after reading
+		inline auto notify_popped() noexcept -> void {
+			m_popped.notify_all();
+		}
+
+		/// @brief Blocks until the queue has entries to read or `stop` is requested. Only woken
+		/// by `notify_pushed`
+		///
+		/// @param stop - The stop token to also wake up on
+		inline auto wait_for_entries(const std::stop_token& stop) noexcept -> void {
+			m_pushed.wait_until([this]() { return !empty(); }, stop);
+		}
+
+		/// @brief Blocks until the queue has entries to read, `stop` is requested, or `timeout`
+		/// elapses
+		///
+		/// @param stop - The stop token to also wake up on
+		/// @param timeout - The longest to wait for
+		///
+		/// @return Whether the queue has entries to read or `stop` was requested
+		template<typename Rep, typename Period>
+		[[nodiscard]] inline auto
+		wait_for_entries(const std::stop_token& stop,
+						 std::chrono::duration<Rep, Period> timeout) noexcept -> bool {
+			return m_pushed.wait_for([this]() { return !empty(); }, stop, timeout);
+		}
+
+		/// @brief Blocks until the queue has room for another entry. Only woken by
+		/// `notify_popped`
+		inline auto wait_for_space() noexcept -> void {
+			m_popped.wait_until([this]() { return !full(); });
+		}
+
+		/// @brief Blocks until the queue has room for another entry, or `timeout` elapses. Only
+		/// woken by `notify_popped`
+		///
+		/// @param timeout - The longest to wait for
+		///
+		/// @return Whether the queue has room for another entry
+		template<typename Rep, typename Period>
+		[[nodiscard]] inline auto
+		wait_for_space(std::chrono::duration<Rep, Period> timeout) noexcept -> bool {
+			return m_popped.wait_for([this]() { return !full(); }, timeout);
+		}
+
+		/// @brief Blocks until every entry in the queue has been read. Only woken by
+		/// `notify_popped`
+		inline auto wait_until_empty() noexcept -> void {
+			m_popped.wait_until([this]() { return empty(); });
+		}
+
+		auto operator=(const LockFreeQueue& queue) -> LockFreeQueue& = delete;
+		auto operator=(LockFreeQueue&& queue) -> LockFreeQueue& = delete;
+
+	  private:
+		static constexpr usize MASK = CAPACITY - 1;
+
+		// written by the producer, read by the consumer
+		alignas(CACHE_LINE_SIZE) std::atomic<usize> m_write_position = 0_usize;
+		// only accessed by the producer
+		usize m_cached_read_position = 0_usize;
+		// written by the consumer, read by the producer
+		alignas(CACHE_LINE_SIZE) std::atomic<usize> m_read_position = 0_usize;
+		// only accessed by the consumer
+		usize m_cached_write_position = 0_usize;
+		alignas(CACHE_LINE_SIZE) std::array<detail::ElementStorage<T>, CAPACITY> m_entries = {};
+		alignas(CACHE_LINE_SIZE) utils::EventCount m_pushed = utils::EventCount();
+		alignas(CACHE_LINE_SIZE) utils::EventCount m_popped = utils::EventCount();
+
+		template<typename... Args>
+		[[nodiscard]] inline auto
+		push_or_err(Args&&... args) noexcept -> Result<bool, LockFreeQueueError> {
+			if(try_emplace(std::forward<Args>(args)...)) {
+				return Ok(true);
+			}
+
+			return Err(LockFreeQueueError(LockFreeQueueErrorType::QueueIsFull));
+		}
 	};
 	IGNORE_PADDING_STOP
 } // namespace hyperion
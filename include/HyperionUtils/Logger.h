@@ -5,21 +5,38 @@
 /// and output configuration is configurable by supplying the desired `Sink`s on creation
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <filesystem>
 #include <gsl/gsl>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <source_location>
+#include <string_view>
 #include <system_error>
 #include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "BasicTypes.h"
 #include "LockFreeQueue.h"
+#include "Span.h"
 #include "Logger.h"
+#include "logging/CallSite.h"
 #include "logging/Config.h"
+#include "logging/DeferredEntry.h"
 #include "logging/Entry.h"
+#include "logging/Field.h"
 #include "logging/Sink.h"
+#include "logging/SinkWorker.h"
+#include "logging/Statistics.h"
+#include "logging/TimeStamp.h"
+#include "logging/ThreadBuffers.h"
 #include "logging/fmtIncludes.h"
 
 namespace hyperion {
@@ -34,6 +51,9 @@ namespace hyperion {
 		/// @brief the requested log level for the entry is
 		/// lower than the minium level for the logger
 		LogLevelError = 2,
+		/// @brief the logging queue stayed full for longer than the logger's flush timeout,
+		/// with `LogPolicy::FlushWhenFull`
+		FlushTimeout = 3,
 	};
 
 	/// @brief Alias for the Error type we might recieve from the internal queue
@@ -75,9 +95,12 @@ namespace hyperion {
 			else if(category == LogErrorType::QueueingError) {
 				return "Queueing entry failed"s;
 			}
-			else if(category == LogErrorType::QueueingError) {
+			else if(category == LogErrorType::LogLevelError) {
 				return "Configured logging level is higher than the given entry"s;
 			}
+			else if(category == LogErrorType::FlushTimeout) {
+				return "Timed out waiting for space in the logging queue"s;
+			}
 			else {
 				return "Unknown Error"s;
 			}
@@ -127,6 +150,9 @@ namespace hyperion {
 			if(type == LogErrorType::QueueingError) {
 				Error::m_message = "Error writing to logging queue"s;
 			}
+			else if(type == LogErrorType::FlushTimeout) {
+				Error::m_message = "Timed out waiting for space in the logging queue"s;
+			}
 			else {
 				Error::m_message = "Logging Level of this Logger is higher than the given entry"s;
 			}
@@ -166,159 +192,214 @@ namespace hyperion {
 	  public:
 		static constexpr LogPolicy POLICY = LogParameters::policy;
 		static constexpr LogLevel MINIMUM_LEVEL = LogParameters::minimum_level;
+		static constexpr LogBuffering BUFFERING = LogParameters::buffering;
+		static constexpr LogFormatting FORMATTING = LogParameters::formatting;
+		static constexpr LogTimeStampPrecision TIME_STAMP_PRECISION
+			= LogParameters::time_stamp_precision;
 
 		/// @brief Default Constructor
 		Logger()
-			// clang-format off
-			: m_message_thread([messages = m_messages, log_file_path = m_log_file_path]
-					(const std::stop_token& stop)
-				{
-					auto log_file = fmt::output_file(log_file_path);
-					while(!stop.stop_requested()) {
-						if(auto res = messages->read()) {
-							auto message = res.unwrap();
-								log_file.print(message.style(), "{}", message.entry());
-								//fmt::print(message.style(), "{}", message.entry());
-						}
-					}
-					log_file.close();
-				})
-		{
-				//clang-format on
+			: m_message_thread(&Logger::message_thread_function,
+							   m_messages,
+							   m_sinks_backed_up,
+							   m_statistics,
+							   m_call_sites,
+							   make_default_sinks(m_log_file_path)) {
 		}
 		explicit Logger(const std::string& root_name) // NOLINT
 			: m_root_name(root_name), m_log_file_path(create_log_file_path()),
-			  // clang-format off
-			  m_message_thread([messages = m_messages, log_file_path = m_log_file_path]
-					(const std::stop_token& stop)
-				{
-					auto log_file = fmt::output_file(log_file_path);
-					while(!stop.stop_requested()) {
-						if(auto res = messages->read()) {
-							auto message = res.unwrap();
-							log_file.print(message.style(), "{}", message.entry());
-							//fmt::print("{}", message);
-						}
-					}
-					log_file.close();
-				})
-		{
-				//clang-format on
+			  m_message_thread(&Logger::message_thread_function,
+							   m_messages,
+							   m_sinks_backed_up,
+							   m_statistics,
+							   m_call_sites,
+							   make_default_sinks(m_log_file_path)) {
 		}
 		explicit Logger(std::string&& root_name)
 			: m_root_name(root_name), m_log_file_path(create_log_file_path()),
-			  // clang-format off
-			  m_message_thread([messages = m_messages, log_file_path = m_log_file_path]
-					(const std::stop_token& stop)
-				{
-					auto log_file = fmt::output_file(log_file_path);
-					while(!stop.stop_requested()) {
-						if(auto res = messages->read()) {
-							auto message = res.unwrap();
-							log_file.print(message.style(), "{}", message.entry());
-							//fmt::print("{}", message);
-						}
-					}
-					log_file.close();
-				})
-		{
-				//clang-format on
+			  m_message_thread(&Logger::message_thread_function,
+							   m_messages,
+							   m_sinks_backed_up,
+							   m_statistics,
+							   m_call_sites,
+							   make_default_sinks(m_log_file_path)) {
 		}
 		Logger(const std::string& root_name, const std::string& directory_name) // NOLINT
 			: m_root_name(root_name), m_directory_name(directory_name),
 			  m_log_file_path(create_log_file_path()),
-			  // clang-format off
-			  m_message_thread([messages = m_messages, log_file_path = m_log_file_path]
-					(const std::stop_token& stop)
-				{
-					auto log_file = fmt::output_file(log_file_path);
-					while(!stop.stop_requested()) {
-						if(auto res = messages->read()) {
-							auto message = res.unwrap();
-							log_file.print(message.style(), "{}", message.entry());
-							//fmt::print("{}", message);
-						}
-					}
-					log_file.close();
-				})
-		{
-				//clang-format on
+			  m_message_thread(&Logger::message_thread_function,
+							   m_messages,
+							   m_sinks_backed_up,
+							   m_statistics,
+							   m_call_sites,
+							   make_default_sinks(m_log_file_path)) {
 		}
 		Logger(const std::string& root_name, std::string&& directory_name) // NOLINT
 			: m_root_name(root_name), m_directory_name(directory_name),
 			  m_log_file_path(create_log_file_path()),
-			  // clang-format off
-			  m_message_thread([messages = m_messages, log_file_path = m_log_file_path]
-					(const std::stop_token& stop)
-				{
-					auto log_file = fmt::output_file(log_file_path);
-					while(!stop.stop_requested()) {
-						if(auto res = messages->read()) {
-							auto message = res.unwrap();
-							log_file.print(message.style(), "{}", message.entry());
-							//fmt::print("{}", message);
-						}
-					}
-					log_file.close();
-				})
-		{
-				//clang-format on
+			  m_message_thread(&Logger::message_thread_function,
+							   m_messages,
+							   m_sinks_backed_up,
+							   m_statistics,
+							   m_call_sites,
+							   make_default_sinks(m_log_file_path)) {
 		}
 		Logger(std::string&& root_name, const std::string& directory_name) // NOLINT
 			: m_root_name(root_name), m_directory_name(directory_name),
 			  m_log_file_path(create_log_file_path()),
-			  // clang-format off
-			  m_message_thread([messages = m_messages, log_file_path = m_log_file_path]
-			  		(const std::stop_token& stop)
-				{
-					auto log_file = fmt::output_file(log_file_path);
-					while(!stop.stop_requested()) {
-						if(auto res = messages->read()) {
-							auto message = res.unwrap();
-							log_file.print(message.style(), "{}", message.entry());
-							//fmt::print("{}", message);
-						}
-					}
-					log_file.close();
-				})
-		{
-				//clang-format on
+			  m_message_thread(&Logger::message_thread_function,
+							   m_messages,
+							   m_sinks_backed_up,
+							   m_statistics,
+							   m_call_sites,
+							   make_default_sinks(m_log_file_path)) {
 		}
 		Logger(std::string&& root_name, std::string&& directory_name)
 			: m_root_name(root_name), m_directory_name(directory_name),
 			  m_log_file_path(create_log_file_path()),
-			  // clang-format off
-			  m_message_thread([messages = m_messages, log_file_path = m_log_file_path]
-			  		(const std::stop_token& stop)
-				{
-					auto log_file = fmt::output_file(log_file_path);
-					while(!stop.stop_requested()) {
-						if(auto res = messages->read()) {
-							auto message = res.unwrap();
-							log_file.print(message.style(), "{}", message.entry());
-							//fmt::print("{}", message);
-						}
-					}
-					log_file.close();
-				})
-		{
-				//clang-format on
+			  m_message_thread(&Logger::message_thread_function,
+							   m_messages,
+							   m_sinks_backed_up,
+							   m_statistics,
+							   m_call_sites,
+							   make_default_sinks(m_log_file_path)) {
+		}
+		/// @brief Constructs a `Logger` that sinks its entries to each of the given `Sink`s
+		///
+		/// @param sinks - The `Sink`s to sink entries to
+		explicit Logger(Sinks&& sinks)
+			: m_statistics(std::make_shared<LoggerStatistics>(sinks.size())),
+			  m_message_thread(&Logger::message_thread_function,
+							   m_messages,
+							   m_sinks_backed_up,
+							   m_statistics,
+							   m_call_sites,
+							   std::move(sinks)) {
 		}
 		Logger(const Logger& logger) noexcept = delete;
-		Logger(Logger&& logger) noexcept = default;
+		Logger(Logger&& logger) noexcept
+			: m_messages(std::move(logger.m_messages)), m_root_name(std::move(logger.m_root_name)),
+			  m_directory_name(std::move(logger.m_directory_name)),
+			  m_log_file_path(std::move(logger.m_log_file_path)),
+			  m_level(logger.m_level.load(std::memory_order_relaxed)),
+			  m_flush_timeout(logger.m_flush_timeout.load(std::memory_order_relaxed)),
+			  m_sinks_backed_up(std::move(logger.m_sinks_backed_up)),
+			  m_statistics(std::move(logger.m_statistics)),
+			  m_call_sites(std::move(logger.m_call_sites)),
+			  m_message_thread(std::move(logger.m_message_thread)) {
+		}
 
 		~Logger() noexcept = default;
 
+		/// @brief Returns whether entries of the given level can be logged at all with this
+		/// `Logger`'s `MINIMUM_LEVEL`. Calls that fail this are compiled out
+		///
+		/// @return Whether `Level` is enabled at compile time
+		template<LogLevel Level>
+		[[nodiscard]] inline static constexpr auto is_enabled() noexcept -> bool {
+			return Level >= MINIMUM_LEVEL && MINIMUM_LEVEL != LogLevel::DISABLED
+				   && Level != LogLevel::DISABLED;
+		}
+
+		/// @brief Returns whether an entry of the given level would currently be logged, taking
+		/// both `MINIMUM_LEVEL` and the level set with `set_level` into account
+		///
+		/// @return Whether `Level` is currently enabled
+		template<LogLevel Level>
+		[[nodiscard]] inline auto should_log() const noexcept -> bool {
+			if constexpr(is_enabled<Level>()) {
+				return Level >= m_level.load(std::memory_order_relaxed);
+			}
+			else {
+				return false;
+			}
+		}
+
+		/// @brief Sets the minimum level of entries to log at runtime.
+		/// This can only further restrict `MINIMUM_LEVEL`, not relax it
+		///
+		/// @param level - The new minimum level
+		inline auto set_level(LogLevel level) noexcept -> void {
+			m_level.store(level, std::memory_order_relaxed);
+		}
+
+		/// @brief Returns the minimum level of entries logged at runtime
+		///
+		/// @return The runtime minimum level
+		[[nodiscard]] inline auto level() const noexcept -> LogLevel {
+			return m_level.load(std::memory_order_relaxed);
+		}
+
+		/// @brief Sets the longest a call to `log` waits for space in the queue with
+		/// `LogPolicy::FlushWhenFull` before giving up on its entry and returning
+		/// `LogErrorType::FlushTimeout`. `None` (the default) waits as long as it takes
+		///
+		/// @param timeout - The new timeout, or `None` to wait indefinitely
+		inline auto set_flush_timeout(Option<std::chrono::nanoseconds> timeout) noexcept -> void
+		requires(POLICY == LogPolicy::FlushWhenFull) {
+			m_flush_timeout.store(timeout.is_some() ? std::max(timeout.unwrap().count(), i64(0)) :
+														NO_FLUSH_TIMEOUT,
+								  std::memory_order_relaxed);
+		}
+
+		/// @brief Returns the longest a call to `log` waits for space in the queue, if it's
+		/// bounded
+		///
+		/// @return The flush timeout, or `None` if calls wait indefinitely
+		[[nodiscard]] inline auto flush_timeout() const noexcept -> Option<std::chrono::nanoseconds>
+		requires(POLICY == LogPolicy::FlushWhenFull) {
+			const auto timeout = m_flush_timeout.load(std::memory_order_relaxed);
+			if(timeout == NO_FLUSH_TIMEOUT) {
+				return None();
+			}
+			return Some(std::chrono::nanoseconds(timeout));
+		}
+
+		/// @brief Returns whether any of this `Logger`'s `Sink`s was backed up (ie: still writing
+		/// earlier entries when more arrived) the last time entries were sunk to them. While
+		/// they are, entries back up in the queue, and will soon be dropped, overwritten, or
+		/// block, depending on `POLICY`
+		///
+		/// @return Whether the sinks are backed up
+		[[nodiscard]] inline auto sinks_backed_up() const noexcept -> bool {
+			return m_sinks_backed_up->load(std::memory_order_relaxed);
+		}
+
+		/// @brief Returns a snapshot of this `Logger`'s statistics: how many entries have been
+		/// queued, dropped, overwritten, and sunk, how many bytes have been sunk to each `Sink`,
+		/// and how far behind the message thread is.
+		///
+		/// The counters updated by logging threads are sharded across cache lines, so keeping
+		/// them doesn't add contention between threads logging at the same time
+		///
+		/// @return The current statistics
+		[[nodiscard]] inline auto stats() const noexcept -> LoggerStats {
+			return m_statistics->snapshot();
+		}
+
+		/// @brief Returns the registry of the rate limited and sampled log statements that have
+		/// suppressed entries for this `Logger`. The message thread periodically logs how many
+		/// entries each of them has suppressed. Used by `HYPERION_LOG_LIMITED`
+		///
+		/// @return The registry of call sites
+		[[nodiscard]] inline auto call_sites() noexcept -> CallSiteRegistry& {
+			return *m_call_sites;
+		}
+
 		template<LogLevel Level, typename S, typename... Args, typename Char = fmt::char_t<S>>
-		inline auto log(Option<usize> thread_id, const S& format_string, Args&&... args) noexcept
-			-> Result<bool, LoggerError> {
-			if constexpr(Level >= MINIMUM_LEVEL && MINIMUM_LEVEL != LogLevel::DISABLED) {
+		inline auto log(Option<usize> thread_id,
+						[[maybe_unused]] const S& format_string,
+						[[maybe_unused]] Args&&... args) noexcept -> Result<bool, LoggerError> {
+			if constexpr(is_enabled<Level>()) {
+				if(!should_log<Level>()) {
+					return Err(LoggerError(LogErrorType::LogLevelError));
+				}
+
 				if constexpr(POLICY == LogPolicy::DropWhenFull) {
 					return log_dropping<Level>(thread_id, format_string, args...);
 				}
 				else if constexpr(POLICY == LogPolicy::FlushWhenFull) {
-					log_flushing<Level>(thread_id, format_string, args...);
-					return Ok(true);
+					return log_flushing<Level>(thread_id, format_string, args...);
 				}
 				else {
 					log_overwriting<Level>(thread_id, format_string, args...);
@@ -326,7 +407,7 @@ namespace hyperion {
 				}
 			}
 			else {
-				ignore(format_string, args...);
+				ignore(thread_id);
 				return Err(LoggerError(LogErrorType::LogLevelError));
 			}
 		}
@@ -362,7 +443,25 @@ namespace hyperion {
 		}
 
 		auto operator=(const Logger& logger) noexcept -> Logger& = delete;
-		auto operator=(Logger&& logger) noexcept -> Logger& = default;
+		auto operator=(Logger&& logger) noexcept -> Logger& {
+			if(this == &logger) {
+				return *this;
+			}
+
+			m_messages = std::move(logger.m_messages);
+			m_root_name = std::move(logger.m_root_name);
+			m_directory_name = std::move(logger.m_directory_name);
+			m_log_file_path = std::move(logger.m_log_file_path);
+			m_level.store(logger.m_level.load(std::memory_order_relaxed),
+						  std::memory_order_relaxed);
+			m_flush_timeout.store(logger.m_flush_timeout.load(std::memory_order_relaxed),
+								  std::memory_order_relaxed);
+			m_sinks_backed_up = std::move(logger.m_sinks_backed_up);
+			m_statistics = std::move(logger.m_statistics);
+			m_call_sites = std::move(logger.m_call_sites);
+			m_message_thread = std::move(logger.m_message_thread);
+			return *this;
+		}
 
 	  private:
 		[[nodiscard]] inline static constexpr auto get_queue_policy() noexcept -> QueuePolicy {
@@ -374,32 +473,489 @@ namespace hyperion {
 			}
 		}
 
-		std::shared_ptr<LockFreeQueue<Entry, get_queue_policy()>> m_messages
-			= std::make_shared<LockFreeQueue<Entry, get_queue_policy()>>();
+		/// @brief The concurrency of each thread's queue when using `LogBuffering::PerThread`.
+		/// Only one thread ever pushes to each queue, but the thread itself has to be able to
+		/// discard entries when overwriting, so it needs the multi-consumer queue in that case
+		[[nodiscard]] inline static constexpr auto
+		get_thread_queue_concurrency() noexcept -> QueueConcurrency {
+			if constexpr(POLICY == LogPolicy::OverwriteWhenFull) {
+				return QueueConcurrency::MPMC;
+			}
+			else {
+				return QueueConcurrency::SPSC;
+			}
+		}
+
+		/// @brief Stored as the flush timeout when calls to `log` wait indefinitely
+		static constexpr i64 NO_FLUSH_TIMEOUT = -1;
+
+		/// @brief The capacity of each thread's queue when using `LogBuffering::PerThread`
+		static constexpr usize THREAD_QUEUE_CAPACITY = 128_usize;
+
+		using entry_type
+			= std::conditional_t<FORMATTING == LogFormatting::Deferred, DeferredEntry, Entry>;
+		/// @brief Every thread pushes to the shared queue, so it has to be multi-producer
+		using SharedQueue = LockFreeQueue<entry_type,
+										  get_queue_policy(),
+										  DEFAULT_QUEUE_CAPACITY,
+										  QueueConcurrency::MPMC>;
+		using ThreadQueue = LockFreeQueue<entry_type,
+										  get_queue_policy(),
+										  THREAD_QUEUE_CAPACITY,
+										  get_thread_queue_concurrency()>;
+		using Messages = std::conditional_t<BUFFERING == LogBuffering::Shared,
+											SharedQueue,
+											ThreadBufferRegistry<ThreadQueue>>;
+
+		std::shared_ptr<Messages> m_messages = std::make_shared<Messages>();
 		std::string m_root_name = "HyperionLog"s;
 		std::string m_directory_name = "Hyperion"s;
 		std::string m_log_file_path = create_log_file_path();
+		std::atomic<LogLevel> m_level = MINIMUM_LEVEL;
+		// in nanoseconds, or `NO_FLUSH_TIMEOUT`
+		std::atomic<i64> m_flush_timeout = NO_FLUSH_TIMEOUT;
+		std::shared_ptr<std::atomic<bool>> m_sinks_backed_up
+			= std::make_shared<std::atomic<bool>>(false);
+		// sized for the single default sink; `Logger(Sinks&&)` sizes it for the given sinks
+		std::shared_ptr<LoggerStatistics> m_statistics = std::make_shared<LoggerStatistics>(1_usize);
+		std::shared_ptr<CallSiteRegistry> m_call_sites = std::make_shared<CallSiteRegistry>();
 		std::jthread m_message_thread;
 
-		static constexpr fmt::text_style MESSAGE_STYLE = fmt::fg(fmt::color::white);
-		static constexpr fmt::text_style TRACE_STYLE = fmt::fg(fmt::color::steel_blue);
-		static constexpr fmt::text_style INFO_STYLE
-			= fmt::fg(fmt::color::light_green) | fmt::emphasis::italic;
-		static constexpr fmt::text_style WARN_STYLE
-			= fmt::fg(fmt::color::orange) | fmt::emphasis::bold;
-		static constexpr fmt::text_style ERROR_STYLE
-			= fmt::fg(fmt::color::red) | fmt::emphasis::bold;
+		/// @brief The maximum number of entries the message thread drains from the queue at once
+		static constexpr usize MESSAGE_BATCH_SIZE = 64_usize;
+		/// @brief The minimum time between the message thread's reports of the entries suppressed
+		/// by rate limited and sampled log statements
+		static constexpr std::chrono::seconds SUPPRESSION_REPORT_INTERVAL = std::chrono::seconds(1);
+		/// @brief The longest the message thread waits for entries before waking to flush the
+		/// sinks anyway, so their time-based work (ie: `FileSink` rotation) and suppression
+		/// reports still happen while nothing is logged
+		static constexpr std::chrono::seconds IDLE_WAKE_INTERVAL = std::chrono::seconds(1);
+
+		/// @brief Drains `messages` into `sinks` until `stop` is requested
+		///
+		/// Entries are read in batches, so the queue's indices are only updated once per batch
+		/// instead of once per entry. While there's nothing to read the thread parks instead of
+		/// spinning, waking only once per `IDLE_WAKE_INTERVAL` to flush the sinks, so an idle
+		/// `Logger` uses next to no CPU time. With `LogBuffering::PerThread`
+		/// each thread's queue is drained by up to one batch per pass, round-robin.
+		///
+		/// With a single `Sink`, entries are sunk directly from this thread. With more, each
+		/// `Sink` gets its own `SinkWorker`, so a slow sink doesn't hold up the others.
+		///
+		/// With `LogFormatting::Deferred`, sinks that `accepts_deferred` (ie: `BinaryFileSink`)
+		/// are given the `DeferredEntry`s as-is, and entries are only rendered to text if another
+		/// sink needs them.
+		///
+		/// At most once per `SUPPRESSION_REPORT_INTERVAL`, checked whenever the thread wakes, and
+		/// once more when it finishes, a `LogLevel::WARN` entry is sunk for each statement in
+		/// `call_sites` that has suppressed entries since the last report, with the number
+		/// suppressed and the statement's location as fields
+		///
+		/// @param stop - The stop token signalling the thread to finish
+		/// @param messages - The queue, or registry of per-thread queues, to drain
+		/// @param sinks_backed_up - Set to whether any of the sinks is backed up after each batch
+		/// @param statistics - The statistics to record sunk entries and bytes in
+		/// @param call_sites - The rate limited and sampled statements to report suppressions for
+		/// @param sinks - The sinks to sink entries to
+		inline static auto
+		message_thread_function(const std::stop_token& stop,
+								const std::shared_ptr<Messages>& messages,
+								const std::shared_ptr<std::atomic<bool>>& sinks_backed_up,
+								const std::shared_ptr<LoggerStatistics>& statistics,
+								const std::shared_ptr<CallSiteRegistry>& call_sites,
+								Sinks sinks) noexcept -> void {
+			const auto takes_deferred = [](const Sink& sink) {
+				return FORMATTING == LogFormatting::Deferred && sink.accepts_deferred();
+			};
+
+			const auto direct = sinks.size() <= 1;
+			auto workers = std::vector<std::unique_ptr<SinkWorker<>>>();
+			auto deferred_workers = std::vector<std::unique_ptr<SinkWorker<DeferredEntry>>>();
+			if(!direct) {
+				auto index = 0_usize;
+				for(auto& sink : sinks) {
+					auto& bytes_sunk = statistics->bytes_sunk(index++);
+					if(takes_deferred(sink)) {
+						deferred_workers.push_back(
+							std::make_unique<SinkWorker<DeferredEntry>>(std::move(sink),
+																		bytes_sunk));
+					}
+					else {
+						workers.push_back(
+							std::make_unique<SinkWorker<>>(std::move(sink), bytes_sunk));
+					}
+				}
+			}
+			// only used with a single sink; workers count the bytes sunk to their own sinks
+			const auto record_bytes = [&statistics](usize index, usize bytes) {
+				auto& bytes_sunk = statistics->bytes_sunk(index);
+				bytes_sunk.store(bytes_sunk.load(std::memory_order_relaxed) + bytes,
+								 std::memory_order_relaxed);
+			};
+			[[maybe_unused]] const auto needs_rendering
+				= direct ? std::any_of(sinks.begin(),
+									   sinks.end(),
+									   [&](const Sink& sink) { return !takes_deferred(sink); }) :
+							 !workers.empty();
+
+			const auto push_to = [](auto& to, auto entries) {
+				if(to.empty()) {
+					return;
+				}
+				for(auto i = 0_usize; i < to.size() - 1_usize; ++i) {
+					for(const auto& entry : entries) {
+						to[i]->push(std::remove_cvref_t<decltype(entry)>(entry));
+					}
+					to[i]->notify();
+				}
+				for(auto& entry : entries) {
+					to.back()->push(std::move(entry));
+				}
+				to.back()->notify();
+			};
+			const auto dispatch = [&](Span<Entry> entries) {
+				if(direct) {
+					auto index = 0_usize;
+					for(auto& sink : sinks) {
+						if(!takes_deferred(sink)) {
+							record_bytes(index,
+										 sink.sink_batch(Span<const Entry>::make_span(
+											 entries.data(),
+											 entries.size())));
+						}
+						++index;
+					}
+				}
+				else {
+					push_to(workers, entries);
+				}
+			};
+			[[maybe_unused]] const auto dispatch_deferred = [&](Span<DeferredEntry> entries) {
+				if(direct) {
+					auto index = 0_usize;
+					for(auto& sink : sinks) {
+						if(takes_deferred(sink)) {
+							record_bytes(index,
+										 sink.sink_deferred_batch(
+											 Span<const DeferredEntry>::make_span(
+												 entries.data(),
+												 entries.size())));
+						}
+						++index;
+					}
+				}
+				else {
+					push_to(deferred_workers, entries);
+				}
+			};
+			const auto update_backed_up = [&]() {
+				const auto is_backed_up = [](const auto& sink) { return sink->is_backed_up(); };
+				const auto backed_up
+					= direct ? std::any_of(sinks.begin(),
+										   sinks.end(),
+										   [](const Sink& sink) { return sink.is_backed_up(); }) :
+								 std::any_of(workers.begin(), workers.end(), is_backed_up)
+									 || std::any_of(deferred_workers.begin(),
+													deferred_workers.end(),
+													is_backed_up);
+				sinks_backed_up->store(backed_up, std::memory_order_relaxed);
+			};
+			const auto flush = [&]() {
+				// workers flush their own sinks when they catch up
+				if(direct) {
+					for(auto& sink : sinks) {
+						sink.flush();
+					}
+				}
+				update_backed_up();
+			};
+
+			auto batch = std::array<entry_type, MESSAGE_BATCH_SIZE>();
+			// deferred entries are rendered into `Entry`s for the sinks
+			[[maybe_unused]] auto rendered
+				= std::conditional_t<FORMATTING == LogFormatting::Deferred,
+									 std::array<Entry, MESSAGE_BATCH_SIZE>,
+									 std::array<Entry, 0>>();
+			[[maybe_unused]] auto buffer = fmt::memory_buffer();
+			// deferred entries carry a `steady_clock` timestamp, so we need a reference point to
+			// convert them to wall-clock time
+			[[maybe_unused]] const auto system_start = std::chrono::system_clock::now();
+			[[maybe_unused]] const auto steady_start = DeferredEntry::clock::now();
+
+			const auto render = [&](const DeferredEntry& message) {
+				const auto time = system_start
+								  + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+									  message.timestamp() - steady_start);
+
+				buffer.clear();
+				message.format_to(buffer);
+				const auto time_stamp
+					= TimeStampCache::instance().time_stamp<TIME_STAMP_PRECISION>(time);
+				auto entry
+					= Entry::logged(message.level(), message.thread_id(), time_stamp.view());
+				entry.append("{}", std::string_view(buffer.data(), buffer.size()));
+				entry.end_message();
+				return entry;
+			};
+			// sinks the first `num_entries` entries in `batch`
+			const auto sink_batch = [&](usize num_entries) {
+				if constexpr(FORMATTING == LogFormatting::Deferred) {
+					if(needs_rendering) {
+						for(auto i = 0_usize; i < num_entries; ++i) {
+							rendered[i] = render(batch[i]); // NOLINT
+						}
+						dispatch(Span<Entry>::make_span(rendered.data(), num_entries));
+					}
+					// this moves the entries to the last worker, so it has to come after rendering
+					dispatch_deferred(Span<DeferredEntry>::make_span(batch.data(), num_entries));
+				}
+				else {
+					dispatch(Span<Entry>::make_span(batch.data(), num_entries));
+				}
+				update_backed_up();
+			};
+			const auto drain = [&](auto& queue) {
+				statistics->record_queue_size(queue.size());
+				const auto num_read
+					= queue.read_n(Span<entry_type>::make_span(batch.data(), batch.size()));
+				if(num_read != 0_usize) {
+					// per-thread queues leave waking producers blocked on a full queue to us
+					if constexpr(BUFFERING == LogBuffering::PerThread
+								 && POLICY == LogPolicy::FlushWhenFull)
+					{
+						queue.notify_popped();
+					}
+					sink_batch(num_read);
+					statistics->record_sunk(num_read);
+				}
+				return num_read;
+			};
+
+			auto last_report = std::chrono::steady_clock::now();
+			const auto report_suppressed = [&](bool force) {
+				if constexpr(is_enabled<LogLevel::WARN>()) {
+					if(call_sites->empty()) {
+						return;
+					}
+
+					const auto now = std::chrono::steady_clock::now();
+					if(!force && now - last_report < SUPPRESSION_REPORT_INTERVAL) {
+						return;
+					}
+					last_report = now;
+
+					// these were never queued, so they aren't counted as sunk
+					auto num_entries = 0_usize;
+					call_sites->for_each([&](CallSite& site) {
+						const auto suppressed = site.take_suppressed();
+						if(suppressed == 0_u64) {
+							return;
+						}
+
+						const auto& location = site.location();
+						batch[num_entries++] = make_queued_entry<LogLevel::WARN>( // NOLINT
+							None(),
+							"suppressed entries from a rate limited or sampled log statement",
+							field("suppressed", suppressed),
+							field("file", std::string_view(location.file_name())),
+							field("line", location.line()),
+							field("function", std::string_view(location.function_name())));
+						if(num_entries == batch.size()) {
+							sink_batch(num_entries);
+							num_entries = 0_usize;
+						}
+					});
+					if(num_entries != 0_usize) {
+						sink_batch(num_entries);
+					}
+				}
+				else {
+					ignore(force, last_report);
+				}
+			};
+
+			if constexpr(BUFFERING == LogBuffering::Shared) {
+				while(!stop.stop_requested()) {
+					report_suppressed(false);
+					if(drain(*messages) == 0_usize) {
+						// we've caught up, so write out anything the sinks have buffered before
+						// waiting
+						flush();
+						std::ignore = messages->wait_for_entries(stop, IDLE_WAKE_INTERVAL);
+					}
+				}
+
+				// write anything queued before we were stopped
+				while(drain(*messages) != 0_usize) {
+				}
+			}
+			else {
+				auto buffers = std::vector<typename Messages::buffer_type>();
+				while(!stop.stop_requested()) {
+					report_suppressed(false);
+					messages->collect_registered(buffers);
+					auto num_read = 0_usize;
+					for(auto& thread_buffer : buffers) {
+						num_read += drain(*thread_buffer);
+					}
+					Messages::prune(buffers);
+
+					if(num_read == 0_usize) {
+						flush();
+						messages->wait_for_entries(buffers, stop, IDLE_WAKE_INTERVAL);
+					}
+				}
+
+				// write anything queued before we were stopped
+				messages->collect_registered(buffers);
+				for(auto& thread_buffer : buffers) {
+					while(drain(*thread_buffer) != 0_usize) {
+					}
+				}
+			}
+			report_suppressed(true);
+			flush();
+		}
 
-		[[nodiscard]] inline static auto create_time_stamp() noexcept -> std::string {
-			return fmt::format("[{:%Y-%m-%d|%H-%M-%S}]", fmt::localtime(std::time(nullptr)));
+		/// @brief Creates the `Sinks` used when a `Logger` isn't given any: a single `FileSink`
+		/// writing to `log_file_path`
+		///
+		/// @param log_file_path - The path of the log file to write to
+		///
+		/// @return The default `Sinks`
+		[[nodiscard]] inline static auto make_default_sinks(const std::string& log_file_path)
+			-> Sinks {
+			auto sinks = Sinks();
+			sinks.push_back(make_sink<FileSink<>>(
+				std::make_unique<fmt::ostream>(fmt::output_file(log_file_path))));
+			return sinks;
+		}
+
+		/// @brief Returns the queue the calling thread should push its entries to
+		///
+		/// @return The shared queue, or the calling thread's queue with `LogBuffering::PerThread`
+		[[nodiscard]] inline auto producer_queue() noexcept -> auto& {
+			if constexpr(BUFFERING == LogBuffering::Shared) {
+				return *m_messages;
+			}
+			else {
+				return m_messages->local_buffer();
+			}
+		}
+
+		/// @brief Wakes the message thread if it's waiting on entries from this thread.
+		/// The shared queue does this itself, so this only does anything for
+		/// `LogBuffering::PerThread`
+		inline auto notify_message_thread() noexcept -> void {
+			if constexpr(BUFFERING == LogBuffering::PerThread) {
+				m_messages->notify_consumer();
+			}
+		}
+
+		[[nodiscard]] inline static auto create_time_stamp() noexcept -> TimeStamp {
+			return TimeStampCache::instance().now<TIME_STAMP_PRECISION>();
+		}
+
+		/// @brief Calls `with_arguments` with the arguments in `args` meant for the format
+		/// string, and then `with_fields` with the trailing `Field`s
+		///
+		/// @param args - The arguments of a call to `log`, as a tuple of references
+		/// @param with_arguments - The function to call with the format arguments
+		/// @param with_fields - The function to call with the fields
+		template<typename Tuple,
+				 typename WithArguments,
+				 typename WithFields,
+				 usize... Arguments,
+				 usize... Fields>
+		inline static auto split_fields(Tuple&& args,
+										WithArguments&& with_arguments,
+										WithFields&& with_fields,
+										[[maybe_unused]] std::index_sequence<Arguments...> arguments,
+										[[maybe_unused]] std::index_sequence<Fields...> fields) noexcept
+			-> void {
+			with_arguments(std::get<Arguments>(args)...);
+			with_fields(std::get<sizeof...(Arguments) + Fields>(args)...);
+		}
+
+		/// @brief Creates the entry to queue for a call to `log`
+		///
+		/// With `LogFormatting::Immediate` the entry is fully formatted here. With
+		/// `LogFormatting::Deferred` this only captures the format string, the arguments, and a
+		/// raw timestamp, unless the call can't be deferred. Calls with `Field`s are never
+		/// deferred, and their fields are only kept typed with `LogFormatting::Immediate`
+		///
+		/// @param thread_id - The id of the calling thread, or `None` to use its `std::thread::id`
+		/// @param format_string - The format string for the entry
+		/// @param args - The arguments to format the entry with, followed by any `Field`s
+		///
+		/// @return The entry to queue
+		template<LogLevel Level, typename S, typename... Args>
+		[[nodiscard]] inline static auto
+		make_queued_entry(Option<usize> thread_id, const S& format_string, Args&&... args) noexcept
+			-> entry_type {
+			static_assert(fields_are_trailing_v<Args...>,
+						  "Fields must come after all of the arguments for the format string");
+			constexpr auto num_fields = num_fields_v<Args...>;
+			constexpr auto num_arguments = sizeof...(Args) - num_fields;
+
+			const auto id = thread_id.is_some() ?
+								  thread_id.unwrap() :
+								  std::hash<std::thread::id>()(std::this_thread::get_id());
+
+			if constexpr(FORMATTING == LogFormatting::Deferred) {
+				const auto timestamp = DeferredEntry::clock::now();
+				// only compile-time format strings are guaranteed to outlive the entry
+				if constexpr(CompileTimeFormatString<S> && num_fields == 0_usize
+							 && DeferredEntry::is_deferrable<Args...>)
+				{
+					const auto format_view = fmt::string_view(format_string);
+					return DeferredEntry(Level,
+										 id,
+										 timestamp,
+										 std::string_view(format_view.data(), format_view.size()),
+										 std::forward<Args>(args)...);
+				}
+				else if constexpr(num_fields == 0_usize) {
+					return DeferredEntry(Level, id, timestamp, fmt::format(format_string, args...));
+				}
+				else {
+					auto text = fmt::memory_buffer();
+					split_fields(
+						std::forward_as_tuple(args...),
+						[&](const auto&... arguments) {
+							fmt::format_to(std::back_inserter(text), format_string, arguments...);
+						},
+						[&](const auto&... fields) {
+							(fmt::format_to(std::back_inserter(text),
+											" {}={}",
+											fields.key,
+											fields.value),
+							 ...);
+						},
+						std::make_index_sequence<num_arguments>(),
+						std::make_index_sequence<num_fields>());
+					return DeferredEntry(Level, id, timestamp, fmt::to_string(text));
+				}
+			}
+			else {
+				// format straight into the entry, so typical entries don't allocate
+				auto entry = Entry::logged(Level, id, create_time_stamp().view());
+				split_fields(
+					std::forward_as_tuple(args...),
+					[&](const auto&... arguments) { entry.append(format_string, arguments...); },
+					[&](const auto&... fields) { entry.end_message(fields...); },
+					std::make_index_sequence<num_arguments>(),
+					std::make_index_sequence<num_fields>());
+				return entry;
+			}
 		}
 
 		[[nodiscard]] inline auto create_log_file_path() const -> std::string {
 			auto temp_dir = std::filesystem::temp_directory_path();
 			temp_dir.append(m_directory_name);
 			std::filesystem::create_directory(temp_dir);
-			auto time_string = create_time_stamp();
-			temp_dir.append(time_string + " "s + m_root_name);
+			const auto time_string = TimeStampCache::instance().time_stamp(std::time(nullptr));
+			temp_dir.append(std::string(time_string.view()) + " "s + m_root_name);
 			temp_dir.replace_extension("log");
 			return temp_dir;
 		}
@@ -409,120 +965,65 @@ namespace hyperion {
 		log_dropping(Option<usize> thread_id, const S& format_string, Args&&... args) noexcept
 			-> Result<bool, LoggerError>
 		requires(POLICY == LogPolicy::DropWhenFull) {
-			const auto timestamp = create_time_stamp();
-			const auto entry = fmt::format(format_string, args...);
-			const auto id = thread_id.is_some() ?
-								  thread_id.unwrap() :
-								  std::hash<std::thread::id>()(std::this_thread::get_id());
-
-			std::string log_type;
-			if constexpr(Level == LogLevel::MESSAGE) {
-				log_type = "MESSAGE"s;
-			}
-			else if constexpr(Level == LogLevel::TRACE) {
-				log_type = "TRACE"s;
-			}
-			else if constexpr(Level == LogLevel::INFO) {
-				log_type = "INFO"s;
-			}
-			else if constexpr(Level == LogLevel::WARN) {
-				log_type = "WARN"s;
+			const auto result = producer_queue().push(
+				make_queued_entry<Level>(thread_id, format_string, std::forward<Args>(args)...));
+			if(result.is_ok()) {
+				m_statistics->record_enqueued();
 			}
-			else if constexpr(Level == LogLevel::ERROR) {
-				log_type = "ERROR"s;
+			else {
+				m_statistics->record_dropped();
 			}
-
-			return m_messages->push(make_entry<entry_level_t<Level>>(
-									"{0}  [Thread ID: {1}] [{2}]: {3}\n",
-									 timestamp,
-									 id,
-									 log_type,
-									 entry))
-						.template map_err<LoggerError>(
-								[](const QueueError& error) { return LoggerError(error); });
+			notify_message_thread();
+			return result.map_err([](const QueueError& error) { return LoggerError(error); });
 		}
 
 		template<LogLevel Level, typename S, typename... Args, typename Char = fmt::char_t<S>>
 		inline auto
 		log_overwriting(Option<usize> thread_id, const S& format_string, Args&&... args) noexcept
 			-> void requires(POLICY == LogPolicy::OverwriteWhenFull) {
-			const auto timestamp = create_time_stamp();
-			const auto entry = fmt::format(format_string, args...);
-			const auto id = thread_id.is_some() ?
-								  thread_id.unwrap() :
-								  std::hash<std::thread::id>()(std::this_thread::get_id());
-
-			std::string log_type;
-			if constexpr(Level == LogLevel::MESSAGE) {
-				log_type = "MESSAGE"s;
+			auto& queue = producer_queue();
+			if(queue.full()) {
+				m_statistics->record_overwritten();
 			}
-			else if constexpr(Level == LogLevel::TRACE) {
-				log_type = "TRACE"s;
-			}
-			else if constexpr(Level == LogLevel::INFO) {
-				log_type = "INFO"s;
-			}
-			else if constexpr(Level == LogLevel::WARN) {
-				log_type = "WARN"s;
-			}
-			else if constexpr(Level == LogLevel::ERROR) {
-				log_type = "ERROR"s;
-			}
-
-			m_messages->push(make_entry<entry_level_t<Level>>(
-									"{0}  [Thread ID: {1}] [{2}]: {3}\n",
-									 timestamp,
-									 id,
-									 log_type,
-									 entry));
+			queue.push(
+				make_queued_entry<Level>(thread_id, format_string, std::forward<Args>(args)...));
+			m_statistics->record_enqueued();
+			notify_message_thread();
 		}
 
 		template<LogLevel Level, typename S, typename... Args, typename Char = fmt::char_t<S>>
 		inline auto
 		log_flushing(Option<usize> thread_id, const S& format_string, Args&&... args) noexcept
-			-> void
+			-> Result<bool, LoggerError>
 		requires(POLICY == LogPolicy::FlushWhenFull) {
-			const auto timestamp = create_time_stamp();
-			const auto entry = fmt::format(format_string, args...);
-			const auto id = thread_id.is_some() ?
-								  thread_id.unwrap() :
-								  std::hash<std::thread::id>()(std::this_thread::get_id());
-
-			std::string log_type;
-			if constexpr(Level == LogLevel::MESSAGE) {
-				log_type = "MESSAGE"s;
-			}
-			else if constexpr(Level == LogLevel::TRACE) {
-				log_type = "TRACE"s;
-			}
-			else if constexpr(Level == LogLevel::INFO) {
-				log_type = "INFO"s;
-			}
-			else if constexpr(Level == LogLevel::WARN) {
-				log_type = "WARN"s;
-			}
-			else if constexpr(Level == LogLevel::ERROR) {
-				log_type = "ERROR"s;
-			}
+			auto entry
+				= make_queued_entry<Level>(thread_id, format_string, std::forward<Args>(args)...);
 
-			const auto logline = fmt::format(MESSAGE_STYLE,
-											 "{0}  [Thread ID: {1}] [{2}]: {3}\n",
-											 timestamp,
-											 id,
-											 log_type,
-											 entry);
+			auto& queue = producer_queue();
+			const auto timeout = m_flush_timeout.load(std::memory_order_relaxed);
+			// only read the clock once we actually have to wait
+			auto deadline = Option<std::chrono::steady_clock::time_point>(None());
+			// a failed push doesn't consume `entry`, so it's safe to retry with it
+			while(!queue.push(std::move(entry))) { // NOLINT(bugprone-use-after-move)
+				// the message thread wakes us as soon as it frees any space, so we don't have to
+				// wait for it to drain the whole queue
+				if(timeout == NO_FLUSH_TIMEOUT) {
+					queue.wait_for_space();
+					continue;
+				}
 
-			if(m_messages->full()) {
-				while(!m_messages->empty()) {
+				if(deadline.is_none()) {
+					deadline = Some(std::chrono::steady_clock::now()
+									+ std::chrono::nanoseconds(timeout));
+				}
+				if(!queue.wait_for_space(deadline.unwrap() - std::chrono::steady_clock::now())) {
+					m_statistics->record_dropped();
+					return Err(LoggerError(LogErrorType::FlushTimeout));
 				}
 			}
-
-			while(!m_messages->push(make_entry<entry_level_t<Level>>(
-									"{0}  [Thread ID: {1}] [{2}]: {3}\n",
-									 timestamp,
-									 id,
-									 log_type,
-									 entry))) {}
+			m_statistics->record_enqueued();
+			notify_message_thread();
+			return Ok(true);
 		}
 	};
 
@@ -628,3 +1129,83 @@ namespace hyperion {
 	IGNORE_UNUSED_TEMPLATES_STOP
 
 } // namespace hyperion
+
+/// @brief Logs an entry of the given level with the given `Logger`.
+///
+/// Unlike calling `Logger::log` directly, the arguments are only evaluated if the entry will
+/// actually be logged: calls below the `Logger`'s `MINIMUM_LEVEL` compile to nothing, and calls
+/// below its runtime level only cost a relaxed atomic load.
+///
+/// @param logger - The `Logger` to log with
+/// @param level - The `LogLevel` of the entry
+/// @param ... - The thread id, format string, and format arguments, as for `Logger::log`
+// clang-format off
+// NOLINTNEXTLINE
+#define HYPERION_LOG(logger, level, ...) \
+	do { \
+		auto& hyperion_logger_ = (logger); \
+		if constexpr(std::remove_cvref_t<decltype(hyperion_logger_)>::template is_enabled<level>()) { \
+			if(hyperion_logger_.template should_log<level>()) { \
+				hyperion::ignore(hyperion_logger_.template log<level>(__VA_ARGS__).is_ok()); \
+			} \
+		} \
+	} while(false)
+
+/// @brief Logs a `LogLevel::MESSAGE` entry with the given `Logger`. See `HYPERION_LOG`
+// NOLINTNEXTLINE
+#define HYPERION_LOG_MESSAGE(logger, ...) HYPERION_LOG(logger, hyperion::LogLevel::MESSAGE, __VA_ARGS__)
+/// @brief Logs a `LogLevel::TRACE` entry with the given `Logger`. See `HYPERION_LOG`
+// NOLINTNEXTLINE
+#define HYPERION_LOG_TRACE(logger, ...) HYPERION_LOG(logger, hyperion::LogLevel::TRACE, __VA_ARGS__)
+/// @brief Logs a `LogLevel::INFO` entry with the given `Logger`. See `HYPERION_LOG`
+// NOLINTNEXTLINE
+#define HYPERION_LOG_INFO(logger, ...) HYPERION_LOG(logger, hyperion::LogLevel::INFO, __VA_ARGS__)
+/// @brief Logs a `LogLevel::WARN` entry with the given `Logger`. See `HYPERION_LOG`
+// NOLINTNEXTLINE
+#define HYPERION_LOG_WARN(logger, ...) HYPERION_LOG(logger, hyperion::LogLevel::WARN, __VA_ARGS__)
+/// @brief Logs a `LogLevel::ERROR` entry with the given `Logger`. See `HYPERION_LOG`
+// NOLINTNEXTLINE
+#define HYPERION_LOG_ERROR(logger, ...) HYPERION_LOG(logger, hyperion::LogLevel::ERROR, __VA_ARGS__)
+
+/// @brief Logs an entry of the given level with the given `Logger`, limiting how many entries
+/// this statement logs.
+///
+/// Each use of the macro gets its own `hyperion::CallSite`, identified by its
+/// `std::source_location`. Once an entry passes the level checks of `HYPERION_LOG`, it's only
+/// logged if it's one of every `sample_one_in` entries from the statement, and the statement
+/// hasn't already logged `max_per_second` entries this second. Both are checked before any
+/// arguments are evaluated, and the `Logger`'s message thread periodically logs how many
+/// entries the statement suppressed.
+///
+/// @param logger - The `Logger` to log with
+/// @param level - The `LogLevel` of the entry
+/// @param max_per_second - The most entries to log per second, or 0 for no limit. Must be a
+/// constant expression
+/// @param sample_one_in - Log one in every this many entries, or 1 to log every entry. Must be a
+/// constant expression
+/// @param ... - The thread id, format string, and format arguments, as for `Logger::log`
+// NOLINTNEXTLINE
+#define HYPERION_LOG_LIMITED(logger, level, max_per_second, sample_one_in, ...) \
+	do { \
+		auto& hyperion_logger_ = (logger); \
+		if constexpr(std::remove_cvref_t<decltype(hyperion_logger_)>::template is_enabled<level>()) { \
+			if(hyperion_logger_.template should_log<level>()) { \
+				static constinit hyperion::CallSite hyperion_call_site_( \
+					std::source_location::current(), max_per_second, sample_one_in); \
+				if(hyperion_call_site_.should_log(hyperion_logger_.call_sites())) { \
+					hyperion::ignore(hyperion_logger_.template log<level>(__VA_ARGS__).is_ok()); \
+				} \
+			} \
+		} \
+	} while(false)
+
+/// @brief Logs one in every `sample_one_in` entries from this statement. See `HYPERION_LOG_LIMITED`
+// NOLINTNEXTLINE
+#define HYPERION_LOG_SAMPLED(logger, level, sample_one_in, ...) \
+	HYPERION_LOG_LIMITED(logger, level, 0, sample_one_in, __VA_ARGS__)
+/// @brief Logs at most `max_per_second` entries per second from this statement. See
+/// `HYPERION_LOG_LIMITED`
+// NOLINTNEXTLINE
+#define HYPERION_LOG_RATE_LIMITED(logger, level, max_per_second, ...) \
+	HYPERION_LOG_LIMITED(logger, level, max_per_second, 1, __VA_ARGS__)
+// clang-format on
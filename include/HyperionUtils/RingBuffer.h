@@ -1,10 +1,13 @@
 /// @brief Compile-time configurable Policy-based ring buffer
 ///
 /// `RingBuffer` has an API matching `std::vector` in its default configuration or can be configured
-/// to provide a subset of that API, but provide lock-free concurrency
+/// to provide a subset of that API, but provide thread-safe concurrency
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <bit>
+#include <cassert>
 #include <compare>
 #include <gsl/gsl>
 #include <iostream>
@@ -12,12 +15,18 @@
 #include <limits>
 #include <memory>
 #include <memory_resource>
+#include <ranges>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 #include "BasicTypes.h"
 #include "Concepts.h"
 #include "Macros.h"
+#include "Monads.h"
+#include "Span.h"
 #include "detail/AllocateUnique.h"
+#include "detail/ElementStorage.h"
 
 namespace hyperion {
 	using concepts::DefaultConstructible, concepts::Integral, concepts::UnsignedIntegral,
@@ -32,6 +41,45 @@ namespace hyperion {
 		ThreadSafe = 1
 	};
 
+	/// @brief How the capacity of a `RingBuffer` is sized, and so how its indices are mapped to
+	/// its storage
+	enum class RingBufferCapacity : usize
+	{
+		/// @brief The capacity is exactly what was requested. One extra storage slot is kept as a
+		/// spacer, so indices wrap with `%`
+		Exact = 0,
+		/// @brief The capacity is rounded up to a power of two. Indices are free-running counters
+		/// masked on access, so no spacer slot is needed and no index computation divides.
+		/// Only supported by `RingBufferType::NotThreadSafe`
+		PowerOfTwo = 1
+	};
+
+	/// @brief The (at most) two contiguous segments of a `RingBuffer`'s storage that hold its
+	/// elements, as returned by `RingBuffer::as_spans`.
+	///
+	/// `first` holds the elements from `front()` up to the end of the storage, and `second` the
+	/// rest, from the start of the storage. `second` is empty unless the elements wrap around
+	///
+	/// @tparam T - The type of the elements, `const` qualified for a `const` `RingBuffer`
+	template<typename T>
+	struct RingBufferSpans {
+		/// @brief The segment holding the elements from `front()`
+		Span<T> first;
+		/// @brief The segment holding the elements that wrapped around, if any
+		Span<T> second;
+
+		/// @brief Returns the total number of elements in both segments
+		///
+		/// @return The number of elements
+		[[nodiscard]] constexpr inline auto size() const noexcept -> usize {
+			return first.size() + second.size();
+		}
+	};
+
+	/// @brief The assumed size of a cache line on the target platform.
+	/// Used to pad concurrently accessed data so that it doesn't share a cache line
+	static constexpr usize CACHE_LINE_SIZE = 64_usize;
+
 	IGNORE_PADDING_START
 	/// @brief A simple Ring Buffer implementation.
 	/// Supports resizing, writing, reading, erasing, and provides mutable and immutable
@@ -52,19 +100,30 @@ namespace hyperion {
 	/// - pop_back: the element removed and `end()`
 	/// - pop_front: the element removed and `begin()`
 	///
-	/// @tparam T - The type to store in the `RingBuffer`. Must Be Default Constructible.
+	/// # Storage
+	/// Slots are uninitialized storage. Elements are constructed in place when they're pushed
+	/// or inserted, and destroyed when they're popped, erased, or overwritten, so only live
+	/// elements are ever constructed, and `T` doesn't need to be default constructible.
+	///
+	/// @tparam T - The type to store in the `RingBuffer`.
 	/// Does not currently support `T` of array types (eg, `T` = `U[]` or `T` = `U[N]`)
-	template<DefaultConstructible T,
+	/// @tparam CapacityPolicy - How the capacity is sized. With `RingBufferCapacity::PowerOfTwo`
+	/// requested capacities are rounded up to the next power of two
+	template<typename T,
 			 RingBufferType ThreadSafety = RingBufferType::NotThreadSafe,
-			 template<typename ElementType> typename Allocator = std::allocator>
+			 template<typename ElementType> typename Allocator = std::allocator,
+			 RingBufferCapacity CapacityPolicy = RingBufferCapacity::Exact>
 	class RingBuffer {
 	  public:
+		static_assert(ThreadSafety == RingBufferType::NotThreadSafe,
+					  "RingBufferType::ThreadSafe RingBuffers only support "
+					  "RingBufferCapacity::Exact");
+
 		/// Default capacity of `RingBuffer`
 		static const constexpr usize DEFAULT_CAPACITY = 16;
+		/// Whether capacities are rounded up to a power of two and indices are masked
+		static const constexpr bool POWER_OF_TWO = CapacityPolicy == RingBufferCapacity::PowerOfTwo;
 		using allocator_traits = std::allocator_traits<Allocator<T>>;
-		using unique_pointer
-			= decltype(allocate_unique<T[]>(std::declval<Allocator<T[]>>(), // NOLINT
-											DEFAULT_CAPACITY));
 
 		/// @brief Random-Access Bidirectional iterator for `RingBuffer`
 		/// @note All navigation operators are checked such that any movement past `begin()` or
@@ -97,12 +156,14 @@ namespace hyperion {
 			constexpr auto operator=(const Iterator& iter) noexcept -> Iterator& = default;
 			constexpr auto operator=(Iterator&& iter) noexcept -> Iterator& = default;
 
+			// compared by index, because with `RingBufferCapacity::PowerOfTwo` `begin()` and
+			// `end()` point to the same slot when the `RingBuffer` is full
 			constexpr inline auto operator==(const Iterator& rhs) const noexcept -> bool {
-				return m_ptr == rhs.m_ptr;
+				return m_current_index == rhs.m_current_index;
 			}
 
 			constexpr inline auto operator!=(const Iterator& rhs) const noexcept -> bool {
-				return m_ptr != rhs.m_ptr;
+				return m_current_index != rhs.m_current_index;
 			}
 
 			constexpr inline auto operator*() const noexcept -> reference {
@@ -256,12 +317,13 @@ namespace hyperion {
 			operator=(const ConstIterator& iter) noexcept -> ConstIterator& = default;
 			constexpr auto operator=(ConstIterator&& iter) noexcept -> ConstIterator& = default;
 
+			// compared by index, like `Iterator`
 			constexpr inline auto operator==(const ConstIterator& rhs) const noexcept -> bool {
-				return m_ptr == rhs.m_ptr;
+				return m_current_index == rhs.m_current_index;
 			}
 
 			constexpr inline auto operator!=(const ConstIterator& rhs) const noexcept -> bool {
-				return m_ptr != rhs.m_ptr;
+				return m_current_index != rhs.m_current_index;
 			}
 
 			constexpr inline auto operator*() const noexcept -> reference {
@@ -391,8 +453,9 @@ namespace hyperion {
 		///
 		/// @param intitial_capacity - The initial capacity of the `RingBuffer`
 		constexpr explicit RingBuffer(usize intitial_capacity) noexcept
-			: m_buffer(allocate_unique<T[]>(m_allocator, intitial_capacity + 1)), // NOLINT
-			  m_loop_index(intitial_capacity), m_capacity(intitial_capacity + 1) {
+			: m_buffer(allocate_storage(storage_size(intitial_capacity))),
+			  m_loop_index(storage_size(intitial_capacity) - 1),
+			  m_capacity(storage_size(intitial_capacity)) {
 		}
 
 		/// @brief Constructs a new `RingBuffer` with the given initial capacity and
@@ -402,20 +465,20 @@ namespace hyperion {
 		/// @param default_value - The value to fill the `RingBuffer` with
 		constexpr RingBuffer(usize intitial_capacity,
 							 const T& default_value) noexcept requires Copyable<T>
-			: m_buffer(allocate_unique<T[]>(m_allocator, // NOLINT
-											intitial_capacity + 1,
-											default_value)),
+			: m_buffer(allocate_storage(storage_size(intitial_capacity))),
 			  m_write_index(intitial_capacity),
 			  m_start_index(0_usize), // NOLINT
-			  m_loop_index(intitial_capacity),
-			  m_capacity(intitial_capacity + 1) {
+			  m_loop_index(storage_size(intitial_capacity) - 1),
+			  m_capacity(storage_size(intitial_capacity)) {
+			for(auto i = 0_usize; i < intitial_capacity; ++i) {
+				construct_slot(i, default_value);
+			}
 		}
 
 		constexpr RingBuffer(std::initializer_list<T> values) noexcept requires Copyable<T>
-			: m_buffer(allocate_unique<T[]>(m_allocator, // NOLINT
-											values.size() + 1)),
-			  m_loop_index(values.size()),
-			  m_capacity(values.size() + 1) {
+			: m_buffer(allocate_storage(storage_size(values.size()))),
+			  m_loop_index(storage_size(values.size()) - 1),
+			  m_capacity(storage_size(values.size())) {
 
 			auto end_ = values.end();
 			for(auto iter = values.begin(); iter != end_; ++iter) {
@@ -424,23 +487,14 @@ namespace hyperion {
 		}
 
 		constexpr RingBuffer(const RingBuffer& buffer) noexcept requires Copyable<T>
-			: m_buffer(allocate_unique<T[]>(m_allocator, buffer.m_capacity)), // NOLINT
-			  m_write_index(0_usize),										  // NOLINT
-			  m_start_index(0_usize),										  // NOLINT
+			: m_buffer(allocate_storage(buffer.m_capacity)),
 			  m_loop_index(buffer.m_loop_index),
 			  m_capacity(buffer.m_capacity) {
-			const auto size = m_buffer.size();
-			for(auto i = 0_usize; i < size; ++i) {
-				push_back(buffer.m_buffer[i]);
-			}
-			// clang-format off
-			m_start_index = buffer.m_start_index; // NOLINT(cppcoreguidelines-prefer-member-initializer)
-			m_write_index = buffer.m_write_index; // NOLINT(cppcoreguidelines-prefer-member-initializer)
-			// clang-format on
+			copy_elements_from(buffer);
 		}
 
 		constexpr RingBuffer(RingBuffer&& buffer) noexcept
-			: m_allocator(buffer.m_allocator), m_buffer(std::move(buffer.m_buffer)),
+			: m_allocator(buffer.m_allocator), m_buffer(buffer.m_buffer),
 			  m_write_index(buffer.m_write_index), m_start_index(buffer.m_start_index),
 			  m_loop_index(buffer.m_loop_index), m_capacity(buffer.m_capacity) {
 			buffer.m_capacity = 0_usize;
@@ -450,7 +504,9 @@ namespace hyperion {
 			buffer.m_buffer = nullptr;
 		}
 
-		~RingBuffer() noexcept = default;
+		constexpr ~RingBuffer() noexcept {
+			release_storage();
+		}
 
 		/// @brief Returns the element at the given index.
 		/// @note This is not checked in the same manner as STL containers:
@@ -470,7 +526,7 @@ namespace hyperion {
 		/// @return The first element
 		[[nodiscard]] constexpr inline auto front() noexcept -> T& {
 			return m_buffer
-				[m_start_index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				[slot(m_start_index)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 		}
 
 		/// @brief Returns the last element in the `RingBuffer`
@@ -478,7 +534,7 @@ namespace hyperion {
 		///
 		/// @return The last element
 		[[nodiscard]] constexpr inline auto back() noexcept -> T& {
-			const auto index = (m_start_index + size() - 1) % (m_capacity);
+			const auto index = get_adjusted_internal_index(size() - 1);
 
 			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 		}
@@ -502,15 +558,21 @@ namespace hyperion {
 		///
 		/// @return `true` if the `RingBuffer` is full, `false` otherwise
 		[[nodiscard]] constexpr inline auto full() const noexcept -> bool {
-			return size() == m_capacity - 1;
+			return size() == capacity();
 		}
 
 		/// @brief Returns the current number of elements in the `RingBuffer`
 		///
 		/// @return The current number of elements
 		[[nodiscard]] constexpr inline auto size() const noexcept -> usize {
-			return m_write_index >= m_start_index ? (m_write_index - m_start_index) :
-													  (m_capacity - (m_start_index - m_write_index));
+			if constexpr(POWER_OF_TWO) {
+				return m_write_index - m_start_index;
+			}
+			else {
+				return m_write_index >= m_start_index ?
+							 (m_write_index - m_start_index) :
+							 (m_capacity - (m_start_index - m_write_index));
+			}
 		}
 
 		/// @brief Returns the maximum possible number of elements this `RingBuffer` could store
@@ -526,7 +588,12 @@ namespace hyperion {
 		///
 		/// @return The current capacity
 		[[nodiscard]] constexpr inline auto capacity() const noexcept -> usize {
-			return m_capacity - 1;
+			if constexpr(POWER_OF_TWO) {
+				return m_capacity;
+			}
+			else {
+				return m_capacity - 1;
+			}
 		}
 
 		/// @brief Reserves more storage for the `RingBuffer`. If `new_capacity` is > capacity,
@@ -537,22 +604,29 @@ namespace hyperion {
 		///
 		/// @param new_capacity - The new capacity of the `RingBuffer`
 		constexpr inline auto reserve(usize new_capacity) noexcept -> void {
-			// we only need to do anything if `new_capacity` is actually larger than `m_capacity`
-			if(new_capacity > m_capacity) {
-				auto temp
-					= allocate_unique<T[], Allocator<T[]>>(m_allocator, new_capacity + 1); // NOLINT
-				auto span = gsl::make_span(&temp[0], new_capacity + 1);
-				std::copy(begin(), end(), span.begin());
-				m_buffer = std::move(temp);
+			// we only need to do anything if `new_capacity` is actually larger than `capacity()`
+			if(new_capacity > capacity()) {
+				const auto new_storage_size = storage_size(new_capacity);
+				auto* temp = allocate_storage(new_storage_size);
+				const auto size_ = size();
+				for(auto i = 0_usize; i < size_; ++i) {
+					allocator_traits::construct(
+						m_allocator,
+						temp + i, // NOLINT
+						move_if_movable(m_buffer[get_adjusted_internal_index(i)])); // NOLINT
+				}
+				release_storage();
+				m_buffer = temp;
 				m_start_index = 0;
-				m_write_index = m_loop_index + 1;
-				m_loop_index = new_capacity;
-				m_capacity = new_capacity + 1;
+				m_write_index = size_;
+				m_loop_index = new_storage_size - 1;
+				m_capacity = new_storage_size;
 			}
 		}
 
 		/// @brief Erases all elements from the `RingBuffer`
 		constexpr inline auto clear() noexcept -> void {
+			discard_front(size());
 			m_start_index = 0;
 			m_write_index = 0;
 		}
@@ -562,11 +636,7 @@ namespace hyperion {
 		///
 		/// @param value - the element to insert
 		constexpr inline auto push_back(const T& value) noexcept -> void requires Copyable<T> {
-			// clang-format off
-			m_buffer[m_write_index] = value; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-			// clang-format on
-
-			increment_indices();
+			emplace_back(value);
 		}
 
 		/// @brief Inserts the given element at the end of the `RingBuffer`
@@ -574,11 +644,7 @@ namespace hyperion {
 		///
 		/// @param value - the element to insert
 		constexpr inline auto push_back(T&& value) noexcept -> void {
-			// clang-format off
-			m_buffer[m_write_index] = std::forward<T>(value); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-			// clang-format on
-
-			increment_indices();
+			emplace_back(std::forward<T>(value));
 		}
 
 		/// @brief Constructs the given element in place at the end of the `RingBuffer`
@@ -591,14 +657,29 @@ namespace hyperion {
 		template<typename... Args>
 		requires ConstructibleFrom<T, Args...>
 		constexpr inline auto emplace_back(Args&&... args) noexcept -> T& {
-			allocator_traits::template construct<T>(m_allocator,
-													&m_buffer[m_write_index], // NOLINT
-													std::forward<Args>(args)...);
-
+			// `args` may refer to `front()`, so when full the new element is built before the
+			// `front()` it replaces is destroyed
+			if(full()) {
+				if constexpr(POWER_OF_TWO) {
+					// the write slot is `front()`'s, so the element is built outside the buffer
+					T element(std::forward<Args>(args)...);
+					destroy_slot(slot(m_start_index));
+					construct_slot(slot(m_write_index), move_if_movable(element));
+				}
+				else {
+					// the write slot is the uninitialized spacer, so the element is built in place.
+					// With a capacity of zero, the spacer is also the start slot, so this destroys
+					// the new element again
+					construct_slot(slot(m_write_index), std::forward<Args>(args)...);
+					destroy_slot(slot(m_start_index));
+				}
+			}
+			else {
+				construct_slot(slot(m_write_index), std::forward<Args>(args)...);
+			}
 			increment_indices();
 
-			auto index = (m_write_index == 0_usize ? m_loop_index : m_write_index - 1);
-			return m_buffer[index]; // NOLINT
+			return back();
 		}
 
 		/// @brief Constructs the given element in place at the location
@@ -613,13 +694,7 @@ namespace hyperion {
 		template<typename... Args>
 		requires ConstructibleFrom<T, Args...>
 		constexpr inline auto emplace(const Iterator& position, Args&&... args) noexcept -> T& {
-			auto index = get_adjusted_internal_index(position.get_index());
-
-			allocator_traits::template construct<T>(m_allocator,
-													&m_buffer[index], // NOLINT
-													std::forward<Args>(args)...);
-
-			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return emplace_internal(position.get_index(), std::forward<Args>(args)...);
 		}
 
 		/// @brief Constructs the given element in place at the location
@@ -634,13 +709,7 @@ namespace hyperion {
 		template<typename... Args>
 		constexpr inline auto
 		emplace(const ConstIterator& position, Args&&... args) noexcept -> T& {
-			auto index = get_adjusted_internal_index(position.get_index());
-
-			allocator_traits::template construct<T>(m_allocator,
-													&m_buffer[index], // NOLINT
-													std::forward<Args>(args)...);
-
-			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return emplace_internal(position.get_index(), std::forward<Args>(args)...);
 		}
 
 		/// @brief Assigns the given element to the position indicated
@@ -651,7 +720,7 @@ namespace hyperion {
 		/// @param element - The element to store in the `RingBuffer`
 		constexpr inline auto
 		insert(const Iterator& position, const T& element) noexcept -> void requires Copyable<T> {
-			insert_internal(position.get_index(), element);
+			insert_emplace_internal(position.get_index(), element);
 		}
 
 		/// @brief Assigns the given element to the position indicated
@@ -661,7 +730,7 @@ namespace hyperion {
 		/// @param position - `Iterator` indicating where in the `RingBuffer` to place the element
 		/// @param element - The element to store in the `RingBuffer`
 		constexpr inline auto insert(const Iterator& position, T&& element) noexcept -> void {
-			insert_internal(position.get_index(), std::forward<T>(element));
+			insert_emplace_internal(position.get_index(), std::forward<T>(element));
 		}
 
 		/// @brief Assigns the given element to the position indicated
@@ -673,7 +742,7 @@ namespace hyperion {
 		/// @param element - The element to store in the `RingBuffer`
 		constexpr inline auto insert(const ConstIterator& position, const T& element) noexcept
 			-> void requires Copyable<T> {
-			insert_internal(position.get_index(), element);
+			insert_emplace_internal(position.get_index(), element);
 		}
 
 		/// @brief Assigns the given element to the position indicated
@@ -684,7 +753,7 @@ namespace hyperion {
 		/// element
 		/// @param element - The element to store in the `RingBuffer`
 		constexpr inline auto insert(const ConstIterator& position, T&& element) noexcept -> void {
-			insert_internal(position.get_index(), std::forward<T>(element));
+			insert_emplace_internal(position.get_index(), std::forward<T>(element));
 		}
 
 		/// @brief Constructs the given element at the insertion position indicated
@@ -772,30 +841,163 @@ namespace hyperion {
 		}
 
 		/// @brief Removes the last element in the `RingBuffer` and returns it
+		/// @note The `RingBuffer` must not be empty
 		///
 		/// @return The last element in the `RingBuffer`
-		[[nodiscard]] constexpr inline auto pop_back() noexcept -> T requires Copyable<T> {
-			T back_ = back();
+		[[nodiscard]] constexpr inline auto pop_back() noexcept -> T {
+			assert(!empty());
+			T back_ = move_if_movable(back());
+			destroy_slot(get_adjusted_internal_index(size() - 1));
 			decrement_write();
 			return back_;
 		}
 
 		/// @brief Removes the first element in the `RingBuffer` and returns it
+		/// @note The `RingBuffer` must not be empty
 		///
 		/// @return The first element in the `RingBuffer`
-		[[nodiscard]] constexpr inline auto pop_front() noexcept -> T requires Copyable<T> {
-			T front_ = front();
+		[[nodiscard]] constexpr inline auto pop_front() noexcept -> T {
+			assert(!empty());
+			T front_ = move_if_movable(front());
+			destroy_slot(slot(m_start_index));
 			increment_start();
 			return front_;
 		}
 
+		/// @brief Inserts copies of the given elements at the end of the `RingBuffer`, in order.
+		/// @note if this pushes past `capacity()`, the elements at the front are overwritten, as
+		/// with `push_back`
+		///
+		/// The elements are copied in at most two contiguous ranges, and the indices are only
+		/// updated once
+		///
+		/// @param values - The elements to insert
+		constexpr inline auto
+		push_back_n(Span<const T> values) noexcept -> void requires Copyable<T> {
+			const auto capacity_ = capacity();
+			if(values.size() == 0_usize || capacity_ == 0_usize) {
+				return;
+			}
+
+			// only the last `capacity()` elements would survive, so skip the rest
+			const auto num_to_push = std::min(values.size(), capacity_);
+			const auto* source = values.data() + (values.size() - num_to_push); // NOLINT
+			if(!std::is_constant_evaluated() && overlaps_storage(source, num_to_push)) {
+				// `values` refers to elements of this `RingBuffer`, which may be destroyed before
+				// they're copied, so they're copied out of it first
+				const auto copies = std::vector<T, Allocator<T>>(source,
+																 source + num_to_push, // NOLINT
+																 m_allocator);
+				push_back_n(Span<const T>::make_span(copies.data(), copies.size()));
+				return;
+			}
+
+			// the slots past the last element are uninitialized, so the first of the new elements
+			// are constructed there. The rest wrap around onto the elements at the front, which
+			// are still alive, so they're assigned over them instead
+			const auto size_ = size();
+			const auto num_to_construct = std::min(num_to_push, m_capacity - size_);
+			const auto num_to_assign = num_to_push - num_to_construct;
+			const auto num_dropped
+				= size_ + num_to_push > capacity_ ? size_ + num_to_push - capacity_ : 0_usize;
+			// elements dropped from the front that aren't assigned over (ie: the one in what
+			// becomes the spacer slot) are destroyed
+			for(auto i = num_to_assign; i < num_dropped; ++i) {
+				destroy_slot(get_adjusted_internal_index(i));
+			}
+			for(auto i = 0_usize; i < num_to_assign; ++i) {
+				m_buffer[get_adjusted_internal_index(i)] = source[num_to_construct + i]; // NOLINT
+			}
+			const auto write_ = slot(m_write_index);
+			const auto num_before_wrap = std::min(num_to_construct, m_capacity - write_);
+			construct_slots(source, num_before_wrap, write_);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			construct_slots(source + num_before_wrap, num_to_construct - num_before_wrap, 0_usize);
+
+			increment_indices_n(num_to_push);
+		}
+
+		/// @brief Inserts the elements of `range` at the end of the `RingBuffer`, in order.
+		/// @note if this pushes past `capacity()`, the elements at the front are overwritten, as
+		/// with `push_back`
+		///
+		/// Contiguous ranges of `T` are inserted with `push_back_n`. Other ranges are inserted
+		/// element by element, moving from them if `range` is an rvalue
+		///
+		/// @param range - The elements to insert
+		template<std::ranges::input_range Range>
+		requires std::constructible_from<T, std::ranges::range_reference_t<Range>>
+		constexpr inline auto append(Range&& range) noexcept -> void {
+			using value_type = std::ranges::range_value_t<Range>;
+			if constexpr(std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>
+						 && concepts::Same<value_type, T> && Copyable<T>)
+			{
+				push_back_n(Span<const T>::make_span(std::ranges::data(range),
+													 std::ranges::size(range)));
+			}
+			else {
+				for(auto&& value : range) {
+					if constexpr(std::is_rvalue_reference_v<Range&&>) {
+						emplace_back(std::move(value));
+					}
+					else {
+						emplace_back(std::forward<decltype(value)>(value));
+					}
+				}
+			}
+		}
+
+		/// @brief Removes up to `destination.size()` elements from the front of the
+		/// `RingBuffer`, moving them into `destination` in order
+		///
+		/// The elements are moved in at most two contiguous ranges, so trivially copyable
+		/// elements are copied with `std::memmove`, and the indices are only updated once
+		///
+		/// @param destination - The span to move the removed elements into
+		///
+		/// @return The number of elements removed
+		[[nodiscard]] constexpr inline auto pop_front_n(Span<T> destination) noexcept -> usize {
+			const auto num_to_pop = std::min(size(), destination.size());
+			auto spans = as_spans();
+			const auto num_before_wrap = std::min(num_to_pop, spans.first.size());
+			const auto move_out = [](T* first, usize count, T* to) {
+				if constexpr(Movable<T>) {
+					std::move(first, first + count, to); // NOLINT
+				}
+				else {
+					std::copy_n(first, count, to);
+				}
+			};
+			move_out(spans.first.data(), num_before_wrap, destination.data());
+			move_out(spans.second.data(),
+					 num_to_pop - num_before_wrap,
+					 destination.data() + num_before_wrap); // NOLINT
+
+			return discard_front(num_to_pop);
+		}
+
+		/// @brief Removes up to `n` elements from the front of the `RingBuffer` without reading
+		/// them, updating the indices once
+		///
+		/// @param n - The number of elements to remove
+		///
+		/// @return The number of elements removed
+		constexpr inline auto discard_front(usize n) noexcept -> usize {
+			const auto num_to_discard = std::min(size(), n);
+			for(auto i = 0_usize; i < num_to_discard; ++i) {
+				destroy_slot(get_adjusted_internal_index(i));
+			}
+			increment_start_n(num_to_discard);
+			return num_to_discard;
+		}
+
 		/// @brief Returns a Random Access Bidirectional iterator over the `RingBuffer`,
 		/// at the beginning
 		///
 		/// @return The iterator, at the beginning
 		[[nodiscard]] constexpr inline auto begin() -> Iterator {
-			T* p = &m_buffer
-					   [m_start_index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			T* p = &m_buffer[slot(m_start_index)];
 
 			return Iterator(p, this, 0_usize);
 		}
@@ -805,8 +1007,8 @@ namespace hyperion {
 		///
 		/// @return The iterator, at the end
 		[[nodiscard]] constexpr inline auto end() -> Iterator {
-			T* p = &m_buffer
-					   [m_write_index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			T* p = &m_buffer[slot(m_write_index)];
 
 			return Iterator(p, this, size());
 		}
@@ -816,8 +1018,8 @@ namespace hyperion {
 		///
 		/// @return The iterator, at the beginning
 		[[nodiscard]] constexpr inline auto cbegin() -> ConstIterator {
-			T* p = &m_buffer
-					   [m_start_index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			T* p = &m_buffer[slot(m_start_index)];
 
 			return ConstIterator(p, this, 0_usize);
 		}
@@ -827,11 +1029,52 @@ namespace hyperion {
 		///
 		/// @return The iterator, at the end
 		[[nodiscard]] constexpr inline auto cend() -> ConstIterator {
-			T* p = &m_buffer
-					   [m_write_index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			T* p = &m_buffer[slot(m_write_index)];
 			return ConstIterator(p, this, size());
 		}
 
+		/// @brief Returns the (at most) two contiguous segments of the underlying storage that
+		/// hold the elements of the `RingBuffer`, in order.
+		///
+		/// Loops over the segments are plain loops over contiguous memory, unlike iterating with
+		/// `Iterator`, which maps every index to its slot, so they can be vectorized, and
+		/// trivially copyable elements can be copied out of them with `std::memcpy`.
+		/// The segments are invalidated by the same operations as `begin()` and `end()`
+		///
+		/// @return The segments holding the elements
+		[[nodiscard]] constexpr inline auto as_spans() noexcept -> RingBufferSpans<T> {
+			return spans_of(m_buffer);
+		}
+
+		/// @brief Returns the (at most) two contiguous segments of the underlying storage that
+		/// hold the elements of the `RingBuffer`, in order. See the non-`const` overload
+		///
+		/// @return The segments holding the elements
+		[[nodiscard]] constexpr inline auto as_spans() const noexcept -> RingBufferSpans<const T> {
+			return spans_of(static_cast<const T*>(m_buffer));
+		}
+
+		/// @brief Calls `function` with each non-empty contiguous segment of the elements of the
+		/// `RingBuffer`, in order. See `as_spans`
+		///
+		/// @param function - The function to call, with the signature `(Span<T> segment)`
+		template<typename Function>
+		requires concepts::Invocable<Function, Span<T>>
+		constexpr inline auto for_each_segment(Function&& function) -> void {
+			for_each_segment_of(as_spans(), std::forward<Function>(function));
+		}
+
+		/// @brief Calls `function` with each non-empty contiguous segment of the elements of the
+		/// `RingBuffer`, in order. See `as_spans`
+		///
+		/// @param function - The function to call, with the signature `(Span<const T> segment)`
+		template<typename Function>
+		requires concepts::Invocable<Function, Span<const T>>
+		constexpr inline auto for_each_segment(Function&& function) const -> void {
+			for_each_segment_of(as_spans(), std::forward<Function>(function));
+		}
+
 		/// @brief Unchecked access-by-index operator
 		///
 		/// @param index - The index to get the corresponding element for
@@ -848,21 +1091,20 @@ namespace hyperion {
 			if(this == &buffer) {
 				return *this;
 			}
-			auto temp = allocate_unique<T[]>(m_allocator, buffer.m_capacity); // NOLINT
-			const auto size = buffer.size();
-			for(auto i = 0_usize; i < size; ++i) {
-				temp[i] = buffer.m_buffer[i];
-			}
-			m_buffer = std::move(temp);
+			release_storage();
+			m_buffer = allocate_storage(buffer.m_capacity);
 			m_capacity = buffer.m_capacity;
-			m_start_index = buffer.m_start_index;
-			m_write_index = buffer.m_write_index;
 			m_loop_index = buffer.m_loop_index;
+			copy_elements_from(buffer);
 			return *this;
 		}
 		constexpr auto operator=(RingBuffer&& buffer) noexcept -> RingBuffer& {
+			if(this == &buffer) {
+				return *this;
+			}
+			release_storage();
 			m_allocator = buffer.m_allocator;
-			m_buffer = std::move(buffer.m_buffer);
+			m_buffer = buffer.m_buffer;
 			m_write_index = buffer.m_write_index;
 			m_start_index = buffer.m_start_index;
 			m_loop_index = buffer.m_loop_index;
@@ -875,15 +1117,215 @@ namespace hyperion {
 		}
 
 	  private:
-		static const constexpr usize DEFAULT_CAPACITY_INTERNAL = DEFAULT_CAPACITY + 1;
+		static_assert(std::has_single_bit(DEFAULT_CAPACITY),
+					  "DEFAULT_CAPACITY must be a power of two, so it's the same for every "
+					  "RingBufferCapacity");
+		static const constexpr usize DEFAULT_CAPACITY_INTERNAL
+			= POWER_OF_TWO ? DEFAULT_CAPACITY : DEFAULT_CAPACITY + 1;
 		Allocator<T> m_allocator = Allocator<T>();
-		unique_pointer m_buffer
-			= allocate_unique<T[]>(m_allocator, DEFAULT_CAPACITY_INTERNAL); // NOLINT
+		// uninitialized storage. Only the slots of the elements in the `RingBuffer` hold live
+		// objects
+		T* m_buffer = allocator_traits::allocate(m_allocator, DEFAULT_CAPACITY_INTERNAL);
+		// with `RingBufferCapacity::PowerOfTwo`, these are free-running counters, and
+		// `m_loop_index` is the mask mapping them to slots
 		usize m_write_index = 0_usize;
 		usize m_start_index = 0_usize;
-		usize m_loop_index = DEFAULT_CAPACITY;
+		usize m_loop_index = DEFAULT_CAPACITY_INTERNAL - 1;
 		usize m_capacity = DEFAULT_CAPACITY_INTERNAL;
 
+		/// @brief Returns the number of slots to allocate for a `RingBuffer` of (at least) the
+		/// given capacity
+		///
+		/// @param capacity - The requested capacity
+		///
+		/// @return The number of slots to allocate
+		[[nodiscard]] constexpr inline static auto storage_size(usize capacity) noexcept -> usize {
+			if constexpr(POWER_OF_TWO) {
+				return std::bit_ceil(std::max(capacity, 1_usize));
+			}
+			else {
+				return capacity + 1;
+			}
+		}
+
+		/// @brief Allocates uninitialized storage for `num_slots` elements
+		///
+		/// @param num_slots - The number of slots to allocate
+		///
+		/// @return The storage
+		[[nodiscard]] constexpr inline auto allocate_storage(usize num_slots) noexcept -> T* {
+			return allocator_traits::allocate(m_allocator, num_slots);
+		}
+
+		/// @brief Destroys the elements in the `RingBuffer` and frees its storage
+		constexpr inline auto release_storage() noexcept -> void {
+			if(m_buffer != nullptr) {
+				discard_front(size());
+				allocator_traits::deallocate(m_allocator, m_buffer, m_capacity);
+				m_buffer = nullptr;
+			}
+		}
+
+		/// @brief Copy constructs the elements of `buffer` into the (uninitialized) storage of
+		/// this, from the first slot, and sets the indices to match
+		///
+		/// @param buffer - The `RingBuffer` to copy the elements of
+		constexpr inline auto copy_elements_from(const RingBuffer& buffer) noexcept -> void {
+			const auto size_ = buffer.size();
+			for(auto i = 0_usize; i < size_; ++i) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				construct_slot(i, buffer.m_buffer[buffer.get_adjusted_internal_index(i)]);
+			}
+			m_start_index = 0_usize;
+			m_write_index = size_;
+		}
+
+		/// @brief Constructs an element in the uninitialized slot at `index` of the underlying
+		/// storage
+		///
+		/// @param index - The index of the slot
+		/// @param args - The constructor arguments for the element
+		template<typename... Args>
+		constexpr inline auto construct_slot(usize index, Args&&... args) noexcept -> void {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			allocator_traits::construct(m_allocator, m_buffer + index, std::forward<Args>(args)...);
+		}
+
+		/// @brief Copy constructs `count` elements from `source` into the uninitialized slots
+		/// starting at `index` of the underlying storage
+		///
+		/// @param source - The elements to copy
+		/// @param count - The number of elements to copy
+		/// @param index - The index of the first slot
+		constexpr inline auto
+		construct_slots(const T* source, usize count, usize index) noexcept -> void {
+			if constexpr(std::is_trivially_copyable_v<T>) {
+				if(!std::is_constant_evaluated()) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					std::uninitialized_copy_n(source, count, m_buffer + index);
+					return;
+				}
+			}
+			for(auto i = 0_usize; i < count; ++i) {
+				construct_slot(index + i, source[i]); // NOLINT
+			}
+		}
+
+		/// @brief Destroys the element in the slot at `index` of the underlying storage, leaving
+		/// it uninitialized
+		///
+		/// @param index - The index of the slot
+		constexpr inline auto destroy_slot(usize index) noexcept -> void {
+			if constexpr(!std::is_trivially_destructible_v<T>) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				allocator_traits::destroy(m_allocator, m_buffer + index);
+			}
+		}
+
+		/// @brief Constructs the given element in place of the element at `external_index`, or at
+		/// the end of the `RingBuffer` if `external_index >= size()`
+		///
+		/// @param external_index - The user-facing index into the `RingBuffer` of the element to
+		/// replace
+		/// @param args - The arguments to the constructor for the element
+		///
+		/// @return A reference to the constructed element
+		template<typename... Args>
+		constexpr inline auto
+		emplace_internal(usize external_index, Args&&... args) noexcept -> T& {
+			// there's no element to replace past the end, so the slot there is uninitialized
+			if(external_index >= size()) {
+				return emplace_back(std::forward<Args>(args)...);
+			}
+
+			// `args` may refer to the element being replaced, so the new one is built before the
+			// old one is destroyed
+			T element(std::forward<Args>(args)...);
+			const auto index = get_adjusted_internal_index(external_index);
+			destroy_slot(index);
+			construct_slot(index, move_if_movable(element));
+
+			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		}
+
+		/// @brief Returns whether any of the `count` elements starting at `first` are in the
+		/// underlying storage
+		///
+		/// @param first - The first element
+		/// @param count - The number of elements
+		///
+		/// @return Whether the elements overlap the underlying storage
+		[[nodiscard]] inline auto
+		overlaps_storage(const T* first, usize count) const noexcept -> bool {
+			const auto less = std::less<const T*>();
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return less(first, m_buffer + m_capacity) && less(m_buffer, first + count);
+		}
+
+		/// @brief Returns `value` as an rvalue if `T` is movable, so it's moved from instead of
+		/// copied
+		///
+		/// @param value - The value to move or copy from
+		///
+		/// @return `value`, as an rvalue if `T` is movable
+		[[nodiscard]] constexpr inline static auto
+		move_if_movable(T& value) noexcept -> decltype(auto) {
+			if constexpr(Movable<T>) {
+				return std::move(value);
+			}
+			else {
+				return static_cast<const T&>(value);
+			}
+		}
+
+		/// @brief Converts the given start or write index into the index of its slot in the
+		/// underlying `T` array
+		///
+		/// @param index - The start or write index
+		///
+		/// @return The index of the slot
+		[[nodiscard]] constexpr inline auto slot(usize index) const noexcept -> usize {
+			if constexpr(POWER_OF_TWO) {
+				return index & m_loop_index;
+			}
+			else {
+				return index;
+			}
+		}
+
+		/// @brief Returns the segments of `storage` holding the elements of the `RingBuffer`.
+		/// The spacer slot used with `RingBufferCapacity::Exact` is always just past the last
+		/// element, so it's never inside either segment
+		///
+		/// @param storage - The underlying `T` array
+		///
+		/// @return The segments holding the elements
+		template<typename U>
+		[[nodiscard]] constexpr inline auto
+		spans_of(U* storage) const noexcept -> RingBufferSpans<U> {
+			const auto size_ = size();
+			const auto start_ = slot(m_start_index);
+			const auto first_size = std::min(size_, m_capacity - start_);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return {Span<U>::make_span(storage + start_, first_size),
+					Span<U>::make_span(storage, size_ - first_size)};
+		}
+
+		/// @brief Calls `function` with each non-empty segment in `spans`
+		///
+		/// @param spans - The segments
+		/// @param function - The function to call
+		template<typename U, typename Function>
+		constexpr inline static auto
+		for_each_segment_of(RingBufferSpans<U> spans, Function&& function) -> void {
+			if(spans.first.size() != 0_usize) {
+				function(spans.first);
+			}
+			if(spans.second.size() != 0_usize) {
+				function(spans.second);
+			}
+		}
+
 		/// @brief Converts the given `RingBuffer` index into the corresponding index into then
 		/// underlying `T` array
 		///
@@ -893,7 +1335,12 @@ namespace hyperion {
 		[[nodiscard]] constexpr inline auto
 		get_adjusted_internal_index(Integral auto index) const noexcept -> usize {
 			auto i = static_cast<usize>(index);
-			return (m_start_index + i) % (m_capacity);
+			if constexpr(POWER_OF_TWO) {
+				return (m_start_index + i) & m_loop_index;
+			}
+			else {
+				return (m_start_index + i) % (m_capacity);
+			}
 		}
 
 		/// @brief Converts the given index into the underlying `T` array into
@@ -905,7 +1352,10 @@ namespace hyperion {
 		[[nodiscard]] constexpr inline auto
 		get_external_index_from_internal(Integral auto index) const noexcept -> usize {
 			auto i = static_cast<usize>(index);
-			if(i >= m_start_index && i <= m_loop_index) {
+			if constexpr(POWER_OF_TWO) {
+				return (i - m_start_index) & m_loop_index;
+			}
+			else if(i >= m_start_index && i <= m_loop_index) {
 				return i - m_start_index;
 			}
 			else if(i < m_start_index) {
@@ -920,12 +1370,36 @@ namespace hyperion {
 		/// and the size property, after pushing an element at the back,
 		/// maintaining the logical `RingBuffer` structure
 		constexpr inline auto increment_indices() noexcept -> void {
-			m_write_index = (m_write_index + 1) % (m_capacity);
+			if constexpr(POWER_OF_TWO) {
+				// if we just overwrote `front()`, push start forward past it
+				if(++m_write_index - m_start_index > m_capacity) {
+					++m_start_index;
+				}
+			}
+			else {
+				m_write_index = (m_write_index + 1) % (m_capacity);
+
+				// if write index is at start, we need to push start forward to maintain
+				// the "invalid" spacer element for this.end()
+				if(m_write_index == m_start_index) {
+					m_start_index = (m_start_index + 1) % (m_capacity);
+				}
+			}
+		}
 
-			// if write index is at start, we need to push start forward to maintain
-			// the "invalid" spacer element for this.end()
-			if(m_write_index == m_start_index) {
-				m_start_index = (m_start_index + 1) % (m_capacity);
+		/// @brief Used to increment the start and write indices after pushing `n` elements at
+		/// the back at once. `n` must be at most `capacity()`
+		///
+		/// @param n - The number of elements pushed
+		constexpr inline auto increment_indices_n(usize n) noexcept -> void {
+			const auto size_ = std::min(size() + n, capacity());
+			if constexpr(POWER_OF_TWO) {
+				m_write_index += n;
+				m_start_index = m_write_index - size_;
+			}
+			else {
+				m_write_index = (m_write_index + n) % m_capacity;
+				m_start_index = (m_write_index + m_capacity - size_) % m_capacity;
 			}
 		}
 
@@ -934,196 +1408,129 @@ namespace hyperion {
 		/// maintaining the logical `RingBuffer` structure
 		constexpr inline auto increment_start() noexcept -> void {
 			if(m_start_index != m_write_index) {
-				m_start_index = (m_start_index + 1) % (m_capacity);
+				if constexpr(POWER_OF_TWO) {
+					++m_start_index;
+				}
+				else {
+					m_start_index = (m_start_index + 1) % (m_capacity);
+				}
+			}
+		}
+
+		/// @brief Used to increment the start index after removing `n` elements from the front
+		/// at once. `n` must be at most `size()`
+		///
+		/// @param n - The number of elements removed
+		constexpr inline auto increment_start_n(usize n) noexcept -> void {
+			if constexpr(POWER_OF_TWO) {
+				m_start_index += n;
+			}
+			else {
+				m_start_index = (m_start_index + n) % m_capacity;
 			}
 		}
 
 		/// @brief Used to decrement the write index into the underlying `T` array
 		/// when popping an element from the back
 		constexpr inline auto decrement_write() noexcept -> void {
-			if(m_write_index == 0_usize) {
-				m_write_index = m_capacity - 1;
+			if(POWER_OF_TWO || m_write_index != 0_usize) {
+				m_write_index--;
 			}
 			else {
-				m_write_index--;
+				m_write_index = m_capacity - 1;
 			}
 		}
 
 		constexpr inline auto decrement_write_n(UnsignedIntegral auto n) noexcept -> void {
 			auto amount_to_decrement = static_cast<usize>(n);
-			if(amount_to_decrement > m_write_index) {
+			if constexpr(POWER_OF_TWO) {
+				m_write_index -= amount_to_decrement;
+			}
+			else if(amount_to_decrement > m_write_index) {
 				amount_to_decrement -= m_write_index;
-				m_write_index = (m_capacity - 1) - amount_to_decrement;
+				m_write_index = m_capacity - amount_to_decrement;
 			}
 			else {
 				m_write_index -= amount_to_decrement;
 			}
 		}
 
-		/// @brief Inserts the given element at the position indicated
+		/// @brief Constructs the given element at the insertion position indicated
 		/// by the `external_index`
 		/// @note if `size() == capacity()` this drops the last element out of the `RingBuffer`
 		///
 		/// @param external_index - The user-facing index into the `RingBuffer` to insert the
 		/// element at
-		/// @param elem - The element to store in the `RingBuffer`
+		/// @param args - The arguments to the constructor for
+		/// the element to store in the `RingBuffer`
+		template<typename... Args>
+		requires ConstructibleFrom<T, Args...>
 		constexpr inline auto
-		insert_internal(usize external_index, const T& elem) noexcept -> void {
-			auto index = get_adjusted_internal_index(external_index);
+		insert_emplace_internal(usize external_index, Args&&... args) noexcept -> T& {
+			// `args` may refer to an element that's moved or dropped below, so the new element is
+			// built first
+			T element(std::forward<Args>(args)...);
 
-			if(index == m_write_index) {
-				emplace_back(elem);
+			// if we're full, drop the last element in the buffer
+			if(full() && external_index < size()) [[likely]] { // NOLINT
+				destroy_slot(get_adjusted_internal_index(size() - 1));
+				decrement_write();
 			}
-			else {
-				const auto size_ = size();
-				auto num_to_move = size_ - external_index;
-				auto j = num_to_move - 1;
-
-				// if we're full, drop the last element in the buffer
-				if(size_ == m_capacity - 1) [[likely]] { // NOLINT
-					num_to_move--;
-					j--;
-					index++;
-				}
 
-				for(auto i = 0_usize; i < num_to_move; ++i, --j) {
-					if constexpr(Movable<T>) {
-						m_buffer[get_adjusted_internal_index(size_ - i)]
-							= std::move(m_buffer[get_adjusted_internal_index(external_index + j)]);
-					}
-					else {
-						m_buffer[get_adjusted_internal_index(size_ - i)]
-							= m_buffer[get_adjusted_internal_index(external_index + j)];
-					}
-				}
+			// compared by index, because with `RingBufferCapacity::PowerOfTwo` the write slot is
+			// also the first element's when we're full
+			if(external_index >= size()) {
+				return emplace_back(move_if_movable(element));
+			}
 
-				m_buffer[index] = elem;
-				increment_indices();
+			// the slot after the last element is uninitialized, so the last element is moved into
+			// it by construction, and the elements before it are shifted back by assignment
+			const auto size_ = size();
+			construct_slot(get_adjusted_internal_index(size_),
+						   move_if_movable(m_buffer[get_adjusted_internal_index(size_ - 1)]));
+			for(auto i = size_ - 1; i > external_index; --i) {
+				m_buffer[get_adjusted_internal_index(i)]
+					= move_if_movable(m_buffer[get_adjusted_internal_index(i - 1)]);
 			}
+
+			const auto index = get_adjusted_internal_index(external_index);
+			destroy_slot(index);
+			construct_slot(index, move_if_movable(element));
+			increment_indices();
+			return m_buffer[index];
 		}
 
-		/// @brief Inserts the given element at the position indicated
-		/// by the `external_index`
-		/// @note if `size() == capacity()` this drops the last element out of the `RingBuffer`
+		/// @brief Erases the element at the given index, returning an `Iterator` to the element
+		/// after the removed one
 		///
-		/// @param external_index - The user-facing index into the `RingBuffer` to insert the
-		/// element at
-		/// @param elem - The element to store in the `RingBuffer`
-		constexpr inline auto insert_internal(usize external_index, T&& elem) noexcept -> void {
-			auto index = get_adjusted_internal_index(external_index);
-
-			if(index == m_write_index) {
-				emplace_back(std::forward<T>(elem));
+		/// @param external_index - The index to the element to remove. This should be a
+		/// `RingBuffer` index: IE, not an interal one into the `T` array
+		///
+		/// @return `Iterator` pointing to the element after the one removed
+		[[nodiscard]] constexpr inline auto
+		erase_internal(usize external_index) noexcept -> Iterator {
+			if(external_index >= size()) [[unlikely]] { // NOLINT
+				return end();
 			}
 			else {
 				const auto size_ = size();
-				auto num_to_move = size_ - external_index;
-				auto j = num_to_move - 1;
-
-				// if we're full, drop the last element in the buffer
-				if(size_ == m_capacity - 1) [[likely]] { // NOLINT
-					num_to_move--;
-					j--;
-					index++;
-				}
-
-				for(auto i = 0_usize; i < num_to_move; ++i, --j) {
+				auto num_to_move = (size_ - 1) - external_index;
+				const auto pos_to_move = external_index + 1;
+				const auto pos_to_replace = external_index;
+				for(auto i = 0_usize; i < num_to_move; ++i) {
 					if constexpr(Movable<T>) {
-						m_buffer[get_adjusted_internal_index(size_ - i)]
-							= std::move(m_buffer[get_adjusted_internal_index(external_index + j)]);
+						m_buffer[get_adjusted_internal_index(pos_to_replace + i)]
+							= std::move(m_buffer[get_adjusted_internal_index(pos_to_move + i)]);
 					}
 					else {
-						m_buffer[get_adjusted_internal_index(size_ - i)]
-							= m_buffer[get_adjusted_internal_index(external_index + j)];
+						m_buffer[get_adjusted_internal_index(pos_to_replace + i)]
+							= m_buffer[get_adjusted_internal_index(pos_to_move + i)];
 					}
 				}
+				destroy_slot(get_adjusted_internal_index(size_ - 1));
+				decrement_write();
 
-				m_buffer[index] = std::forward<T>(elem);
-				increment_indices();
-			}
-		}
-
-		/// @brief Constructs the given element at the insertion position indicated
-		/// by the `external_index`
-		/// @note if `size() == capacity()` this drops the last element out of the `RingBuffer`
-		///
-		/// @param external_index - The user-facing index into the `RingBuffer` to insert the
-		/// element at
-		/// @param args - The arguments to the constructor for
-		/// the element to store in the `RingBuffer`
-		template<typename... Args>
-		requires ConstructibleFrom<T, Args...>
-		constexpr inline auto
-		insert_emplace_internal(usize external_index, Args&&... args) noexcept -> T& {
-			auto index = get_adjusted_internal_index(external_index);
-
-			if(index == m_write_index) {
-				return emplace_back(std::forward<Args>(args)...);
-			}
-			else {
-				const auto size_ = size();
-				auto num_to_move = size_ - external_index;
-				auto j = num_to_move - 1;
-
-				// if we're full, drop the last element in the buffer
-				if(size_ == m_capacity - 1) [[likely]] { // NOLINT
-					num_to_move--;
-					j--;
-					index++;
-				}
-
-				for(auto i = 0_usize; i < num_to_move; ++i, --j) {
-					if constexpr(Movable<T>) {
-						m_buffer[get_adjusted_internal_index(size_ - i)]
-							= std::move(m_buffer[get_adjusted_internal_index(external_index + j)]);
-					}
-					else {
-						m_buffer[get_adjusted_internal_index(size_ - i)]
-							= m_buffer[get_adjusted_internal_index(external_index + j)];
-					}
-				}
-
-				allocator_traits::template construct<T>(m_allocator,
-														&m_buffer[index],
-														std::forward<Args>(args)...);
-
-				increment_indices();
-				return m_buffer[index];
-			}
-		}
-
-		/// @brief Erases the element at the given index, returning an `Iterator` to the element
-		/// after the removed one
-		///
-		/// @param external_index - The index to the element to remove. This should be a
-		/// `RingBuffer` index: IE, not an interal one into the `T` array
-		///
-		/// @return `Iterator` pointing to the element after the one removed
-		[[nodiscard]] constexpr inline auto
-		erase_internal(usize external_index) noexcept -> Iterator {
-			const auto index = get_adjusted_internal_index(external_index);
-
-			if(index == m_write_index) [[unlikely]] { // NOLINT
-				return end();
-			}
-			else {
-				const auto size_ = size();
-				auto num_to_move = (size_ - 1) - external_index;
-				const auto pos_to_move = external_index + 1;
-				const auto pos_to_replace = external_index;
-				for(auto i = 0_usize; i < num_to_move; ++i) {
-					if constexpr(Movable<T>) {
-						m_buffer[get_adjusted_internal_index(pos_to_replace + i)]
-							= std::move(m_buffer[get_adjusted_internal_index(pos_to_move + i)]);
-					}
-					else {
-						m_buffer[get_adjusted_internal_index(pos_to_replace + i)]
-							= m_buffer[get_adjusted_internal_index(pos_to_move + i)];
-					}
-				}
-				decrement_write();
-
-				return begin() + external_index;
+				return begin() + external_index;
 			}
 		}
 
@@ -1139,52 +1546,47 @@ namespace hyperion {
 		[[nodiscard]] constexpr inline auto
 		erase_internal(usize first, usize last) noexcept -> Iterator {
 			const auto size_ = size();
-			const auto last_internal = get_adjusted_internal_index(last);
 			const auto num_to_remove = (last - first);
 
-			if(last_internal > m_write_index) {
-				if(m_write_index > m_start_index) {
-					decrement_write_n(num_to_remove);
-				}
-				else if(m_write_index < m_start_index) {
-					auto num_after_start_index
-						= (m_write_index > num_to_remove ? m_write_index - num_to_remove : 0_usize);
-					auto num_before_start_index = num_to_remove - num_after_start_index;
-					if(num_after_start_index > 0) {
-						num_after_start_index--;
-						m_write_index = (m_capacity - 1) - num_after_start_index;
-					}
-					else {
-						decrement_write_n(num_before_start_index);
-					}
+			// shift the elements after the range back over it. When the range runs to the end
+			// there's nothing to shift, and the returned iterator is `end()`
+			const auto num_to_move = size_ - last;
+			const auto pos_to_move = last;
+			const auto pos_to_replace = first;
+			for(auto i = 0_usize; i < num_to_move; ++i) {
+				if constexpr(Movable<T>) {
+					m_buffer[get_adjusted_internal_index(pos_to_replace + i)]
+						= std::move(m_buffer[get_adjusted_internal_index(pos_to_move + i)]);
 				}
-				return end();
-			}
-			else {
-				const auto num_to_move = size_ - last;
-				const auto pos_to_move = last;
-				const auto pos_to_replace = first;
-				for(auto i = 0_usize; i < num_to_move; ++i) {
-					if constexpr(Movable<T>) {
-						m_buffer[get_adjusted_internal_index(pos_to_replace + i)]
-							= std::move(m_buffer[get_adjusted_internal_index(pos_to_move + i)]);
-					}
-					else {
-						m_buffer[get_adjusted_internal_index(pos_to_replace + i)]
-							= m_buffer[get_adjusted_internal_index(pos_to_move + i)];
-					}
+				else {
+					m_buffer[get_adjusted_internal_index(pos_to_replace + i)]
+						= m_buffer[get_adjusted_internal_index(pos_to_move + i)];
 				}
-				decrement_write_n(num_to_remove);
-
-				return begin() + first;
 			}
+			for(auto i = size_ - num_to_remove; i < size_; ++i) {
+				destroy_slot(get_adjusted_internal_index(i));
+			}
+			decrement_write_n(num_to_remove);
+
+			return begin() + first;
 		}
 	};
 
-	/// @brief A simple Ring Buffer implementation.
+	/// @brief A simple, thread-safe Ring Buffer implementation.
 	/// Supports resizing, writing, reading, erasing, and provides mutable and immutable
 	/// random access iterators.
 	///
+	/// Elements are stored inline in a contiguous array of cache-line-aligned slots, so pushing
+	/// and popping never allocate. Each slot has its own spinlock. `push_back`, `emplace_back`,
+	/// `pop_back`, and `pop_front` claim a slot by locking it and then updating the indices with
+	/// a single compare-and-swap, and only unlock it once they've written to or moved out of it,
+	/// so they can be called concurrently from any number of threads. This is per-slot locking,
+	/// not a lock-free protocol: a thread that needs a slot another thread holds spins, then
+	/// yields, until it's released, so a producer and a consumer reaching the same slot wait on
+	/// each other.
+	/// Random access, iteration, `insert`, `erase`, `reserve`, and `clear` are NOT synchronized
+	/// with concurrent writers and should only be used when the `RingBuffer` is quiescent.
+	///
 	/// # Iterator Invalidation
 	/// * Iterators are lazily evaluated, so will only ever be invalidated at their current state.
 	/// Performing any mutating operation (mutating the iterator, not the underlying data) on them
@@ -1200,106 +1602,61 @@ namespace hyperion {
 	/// - pop_back: the element removed and `end()`
 	/// - pop_front: the element removed and `begin()`
 	///
-	/// @tparam T - The type to store in the `RingBuffer`. Must Be Default Constructible.
+	/// # Storage
+	/// Each slot holds uninitialized storage for one element. An element is constructed in its
+	/// slot while the slot is claimed by a push, and destroyed while it's claimed by the pop,
+	/// erase, or overwrite that removes it, so only the elements between `begin()` and `end()` are
+	/// ever alive, and `T` doesn't need to be default constructible.
+	///
+	/// @tparam T - The type to store in the `RingBuffer`.
 	/// Does not currently support `T` of array types (eg, `T` = `U[]` or `T` = `U[N]`)
-	template<DefaultConstructible T, template<typename ElementType> typename Allocator>
-	class RingBuffer<T, RingBufferType::ThreadSafe, Allocator> {
+	template<typename T, template<typename ElementType> typename Allocator>
+	class RingBuffer<T, RingBufferType::ThreadSafe, Allocator, RingBufferCapacity::Exact> {
 	  public:
 		using index_type = u32;
 
 		/// Default capacity of `RingBuffer`
 		static const constexpr index_type DEFAULT_CAPACITY = 16;
 
-		struct Element {
-			std::shared_ptr<T> m_element = nullptr;
-
-			constexpr Element() noexcept = default;
-			explicit constexpr Element(const std::shared_ptr<T>& element) noexcept
-				: m_element(element) {
-			}
-			explicit constexpr Element(std::shared_ptr<T>&& element) noexcept
-				: m_element(std::move(element)) {
-			}
-			explicit constexpr Element(T* element) noexcept : m_element(element) {
-			}
-			constexpr Element(Allocator<Element>& alloc, const T& element) noexcept
-				: m_element(std::allocate_shared<T, Allocator<Element>>(alloc, element)) {
-			}
-			constexpr Element(Allocator<Element>& alloc, T&& element) noexcept
-				: m_element(std::allocate_shared<T, Allocator<Element>>(alloc, element)) {
-			}
-			template<typename... Args>
-			requires ConstructibleFrom<T, Args...>
-			explicit constexpr Element(Allocator<Element>& alloc, Args&&... args) noexcept
-				: m_element(
-					std::allocate_shared<T, Allocator<Element>>(alloc,
-																std::forward<Args>(args)...)) {
-			}
-			constexpr Element(const Element& element) noexcept = default;
-			constexpr Element(Element&& element) noexcept = default;
-			constexpr ~Element() noexcept = default;
+		/// @brief A single storage slot of the `RingBuffer`.
+		///
+		/// Slots are aligned to `CACHE_LINE_SIZE` so that threads operating on neighbouring
+		/// elements don't contend for the same cache line. `m_locked` is a spinlock guarding
+		/// the slot's element storage: it's `true` while a thread has exclusive access to the slot
+		struct alignas(CACHE_LINE_SIZE) Slot : detail::ElementStorage<T> {
+			std::atomic<bool> m_locked = false;
 
-			inline constexpr auto operator=(const Element& element) noexcept -> Element& = default;
-			inline constexpr auto operator=(Element&& element) noexcept -> Element& = default;
-			inline constexpr auto
-			operator=(const std::shared_ptr<T>& element) noexcept -> Element& {
-				m_element = element;
-				return *this;
-			}
-			inline constexpr auto operator=(std::shared_ptr<T>&& element) noexcept -> Element& {
-				m_element = std::move(element);
-				return *this;
+			/// @brief Acquires exclusive access to this slot, spinning and then yielding until
+			/// any other thread holding it releases it
+			inline auto lock() noexcept -> void {
+				for(auto spins = 0_u32; !try_lock(); ++spins) {
+					if(spins >= MAX_LOCK_SPINS) {
+						std::this_thread::yield();
+					}
+				}
 			}
-			// inline constexpr auto operator=(const T& element) noexcept -> Element& {
-			//	m_element = std::make_shared<T>(element);
-			//	return *this;
-			// }
-			// inline constexpr auto operator=(T&& element) noexcept -> Element& {
-			//	m_element = std::make_shared<T>(element);
-			//	return *this;
-			// }
 
-			inline constexpr auto operator==(const Element& element) const noexcept -> bool {
-				return *m_element == *(element.m_element);
+			/// @brief Attempts to acquire exclusive access to this slot without waiting
+			///
+			/// @return Whether exclusive access was acquired
+			[[nodiscard]] inline auto try_lock() noexcept -> bool {
+				return !m_locked.load(std::memory_order_relaxed)
+					   && !m_locked.exchange(true, std::memory_order_acquire);
 			}
 
-			inline constexpr auto operator!=(const Element& element) const noexcept -> bool {
-				return *(m_element) != *(element.m_element);
+			/// @brief Releases exclusive access to this slot, publishing any writes made to it
+			inline auto unlock() noexcept -> void {
+				m_locked.store(false, std::memory_order_release);
 			}
 
-			// friend inline constexpr auto
-			// operator==(const Element& lhs, const T& rhs) noexcept -> bool {
-			//	return (*lhs.m_element) == rhs;
-			// }
-
-			// friend inline constexpr auto
-			// operator!=(const Element& lhs, const T& rhs) noexcept -> bool {
-			//	return (*lhs.m_element) != rhs;
-			// }
-
-			inline constexpr operator T&() noexcept { // NOLINT
-				return *m_element;
-			}
-			inline constexpr operator const T&() const noexcept { // NOLINT
-				return *m_element;
-			}
-			inline constexpr auto operator*() noexcept -> T& {
-				return *m_element;
-			}
-			inline constexpr auto operator*() const noexcept -> const T& {
-				return *m_element;
-			}
-			inline constexpr auto operator->() noexcept -> T* {
-				return m_element.get();
-			}
-			inline constexpr auto operator->() const noexcept -> const T* {
-				return m_element.get();
-			}
+		  private:
+			static constexpr index_type MAX_LOCK_SPINS = 64_u32;
 		};
-		using allocator_traits = std::allocator_traits<Allocator<Element>>;
+
+		using allocator_traits = std::allocator_traits<Allocator<Slot>>;
 		using unique_pointer
-			= decltype(allocate_unique<Element[]>(std::declval<Allocator<Element[]>>(), // NOLINT
-												  DEFAULT_CAPACITY));
+			= decltype(allocate_unique<Slot[]>(std::declval<Allocator<Slot>>(), // NOLINT
+											   DEFAULT_CAPACITY));
 
 		/// @brief Random-Access Bidirectional iterator for `RingBuffer`
 		/// @note All navigation operators are checked such that any movement past `begin()` or
@@ -1308,9 +1665,9 @@ namespace hyperion {
 		  public:
 			using iterator_category = std::random_access_iterator_tag;
 			using difference_type = std::ptrdiff_t;
-			using value_type = Element;
-			using pointer = Element;
-			using reference = Element&;
+			using value_type = T;
+			using pointer = value_type*;
+			using reference = value_type&;
 
 			constexpr explicit Iterator(pointer ptr,
 										RingBuffer* containerPtr,
@@ -1340,8 +1697,8 @@ namespace hyperion {
 				return m_ptr != rhs.m_ptr;
 			}
 
-			constexpr inline auto operator*() noexcept -> reference {
-				return m_ptr;
+			constexpr inline auto operator*() const noexcept -> reference {
+				return *m_ptr;
 			}
 
 			constexpr inline auto operator->() noexcept -> pointer {
@@ -1355,7 +1712,7 @@ namespace hyperion {
 					m_ptr = m_container_ptr->end().m_ptr;
 				}
 				else {
-					m_ptr = (*m_container_ptr)[m_current_index];
+					m_ptr = &(*m_container_ptr)[m_current_index];
 				}
 				return *this;
 			}
@@ -1370,10 +1727,9 @@ namespace hyperion {
 				if(m_current_index == 0) {
 					return *this;
 				}
-				else {
-					m_current_index--;
-					m_ptr = (*m_container_ptr)[m_current_index];
-				}
+
+				m_current_index--;
+				m_ptr = &(*m_container_ptr)[m_current_index];
 				return *this;
 			}
 
@@ -1396,7 +1752,7 @@ namespace hyperion {
 					temp.m_ptr = temp.m_container_ptr->end().m_ptr;
 				}
 				else {
-					temp.m_ptr = (*temp.m_container_ptr)[temp.m_current_index];
+					temp.m_ptr = &(*temp.m_container_ptr)[temp.m_current_index];
 				}
 				return temp;
 			}
@@ -1419,7 +1775,7 @@ namespace hyperion {
 				}
 				else {
 					temp.m_current_index -= diff;
-					temp.m_ptr = (*temp.m_container_ptr)[temp.m_current_index];
+					temp.m_ptr = &(*temp.m_container_ptr)[temp.m_current_index];
 				}
 				return temp;
 			}
@@ -1467,9 +1823,9 @@ namespace hyperion {
 		  public:
 			using iterator_category = std::random_access_iterator_tag;
 			using difference_type = std::ptrdiff_t;
-			using value_type = Element;
-			using pointer = const Element;
-			using reference = const Element&;
+			using value_type = T;
+			using pointer = const value_type*;
+			using reference = const value_type&;
 
 			constexpr explicit ConstIterator(pointer ptr,
 											 RingBuffer* containerPtr,
@@ -1501,7 +1857,7 @@ namespace hyperion {
 			}
 
 			constexpr inline auto operator*() const noexcept -> reference {
-				return m_ptr;
+				return *m_ptr;
 			}
 
 			constexpr inline auto operator->() const noexcept -> pointer {
@@ -1515,7 +1871,7 @@ namespace hyperion {
 					m_ptr = m_container_ptr->end().m_ptr;
 				}
 				else {
-					m_ptr = (*m_container_ptr)[m_current_index];
+					m_ptr = &(*m_container_ptr)[m_current_index];
 				}
 				return *this;
 			}
@@ -1530,10 +1886,9 @@ namespace hyperion {
 				if(m_current_index == 0) {
 					return *this;
 				}
-				else {
-					m_current_index--;
-					m_ptr = (*m_container_ptr)[m_current_index];
-				}
+
+				m_current_index--;
+				m_ptr = &(*m_container_ptr)[m_current_index];
 				return *this;
 			}
 
@@ -1556,7 +1911,7 @@ namespace hyperion {
 					temp.m_ptr = temp.m_container_ptr->end().m_ptr;
 				}
 				else {
-					temp.m_ptr = (*temp.m_container_ptr)[temp.m_current_index];
+					temp.m_ptr = &(*temp.m_container_ptr)[temp.m_current_index];
 				}
 				return temp;
 			}
@@ -1579,7 +1934,7 @@ namespace hyperion {
 				}
 				else {
 					temp.m_current_index -= diff;
-					temp.m_ptr = (*temp.m_container_ptr)[temp.m_current_index];
+					temp.m_ptr = &(*temp.m_container_ptr)[temp.m_current_index];
 				}
 				return temp;
 			}
@@ -1628,9 +1983,7 @@ namespace hyperion {
 		///
 		/// @param intitial_capacity - The initial capacity of the `RingBuffer`
 		constexpr explicit RingBuffer(index_type intitial_capacity) noexcept
-			: m_buffer(allocate_unique<Element[]>(m_allocator, // NOLINT
-												  intitial_capacity + 1,
-												  m_allocator)),
+			: m_buffer(allocate_unique<Slot[]>(m_allocator, intitial_capacity + 1)), // NOLINT
 			  m_state(intitial_capacity + 1) {
 		}
 
@@ -1641,23 +1994,18 @@ namespace hyperion {
 		/// @param default_value - The value to fill the `RingBuffer` with
 		constexpr RingBuffer(index_type intitial_capacity,
 							 const T& default_value) noexcept requires Copyable<T>
-			: m_buffer(allocate_unique<Element[]>(m_allocator, // NOLINT
-												  intitial_capacity + 1,
-												  m_allocator,
-												  default_value)),
+			: m_buffer(allocate_unique<Slot[]>(m_allocator, intitial_capacity + 1)), // NOLINT
 			  m_state(intitial_capacity + 1, 0U, intitial_capacity) {
+			for(auto i = 0_u32; i < intitial_capacity; ++i) {
+				construct_slot(i, default_value);
+			}
 		}
 
 		constexpr RingBuffer(const RingBuffer& buffer) noexcept requires Copyable<T>
-			: m_buffer(allocate_unique<Element[]>(m_allocator, // NOLINT
-												  buffer.m_capacity,
-												  m_allocator)),
-			  m_state(buffer.m_capacity) {
-			const auto size = buffer.size();
-			for(auto i = 0_u32; i < size; ++i) {
-				push_back(buffer.m_buffer[i]);
-			}
-			m_state = buffer.m_state;
+			: m_buffer(allocate_unique<Slot[]>(m_allocator, // NOLINT
+											   buffer.m_state.capacity())),
+			  m_state(buffer.m_state.capacity()) {
+			copy_elements_from(buffer);
 		}
 
 		constexpr RingBuffer(RingBuffer&& buffer) noexcept
@@ -1667,7 +2015,11 @@ namespace hyperion {
 			buffer.m_buffer = nullptr;
 		}
 
-		~RingBuffer() noexcept = default;
+		~RingBuffer() noexcept {
+			if(m_buffer != nullptr) {
+				clear();
+			}
+		}
 
 		/// @brief Returns the element at the given index.
 		/// @note This is not checked in the same manner as STL containers:
@@ -1676,36 +2028,36 @@ namespace hyperion {
 		/// @param index - The index of the desired element
 		///
 		/// @return The element at the given index, or at capacity - 1 if index >= capacity
-		[[nodiscard]] constexpr inline auto at(Integral auto index) noexcept -> Element {
+		[[nodiscard]] constexpr inline auto at(Integral auto index) noexcept -> T& {
 			const auto i = m_state.adjusted_index(static_cast<index_type>(index));
 
-			return m_buffer[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return m_buffer[i].value(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 		}
 
 		/// @brief Returns the first element in the `RingBuffer`
 		///
 		/// @return The first element
-		[[nodiscard]] constexpr inline auto front() noexcept -> Element {
-			return m_buffer
-				[m_state.start()]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		[[nodiscard]] constexpr inline auto front() noexcept -> T& {
+			return m_buffer[m_state.start()] // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				.value();
 		}
 
 		/// @brief Returns the last element in the `RingBuffer`
 		/// @note If <= 1 elements are in the `RingBuffer`, this will be the same as `front`
 		///
 		/// @return The last element
-		[[nodiscard]] constexpr inline auto back() noexcept -> Element {
+		[[nodiscard]] constexpr inline auto back() noexcept -> T& {
 			const auto index = m_state.back();
 
-			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return m_buffer[index].value(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 		}
 
-		/// @brief Returns a pointer to the underlying data in the `RingBuffer`.
+		/// @brief Returns a pointer to the underlying slots in the `RingBuffer`.
 		/// @note This is not sorted in any way to match the representation used by the `RingBuffer`
 		///
-		/// @return A pointer to the underlying data
-		[[nodiscard]] constexpr inline auto data() noexcept -> Element* {
-			return m_buffer;
+		/// @return A pointer to the underlying slots
+		[[nodiscard]] constexpr inline auto data() noexcept -> Slot* {
+			return m_buffer.get();
 		}
 
 		/// @brief Returns whether the `RingBuffer` is empty
@@ -1753,22 +2105,30 @@ namespace hyperion {
 		///
 		/// @param new_capacity - The new capacity of the `RingBuffer`
 		constexpr inline auto reserve(index_type new_capacity) noexcept -> void {
-			auto capacity_ = m_state.capacity();
+			const auto capacity_ = m_state.capacity();
 
 			// we only need to do anything if `new_capacity` is actually larger than `m_capacity`
 			if(new_capacity > capacity_ - 1) {
-				auto temp = allocate_unique<Element[]>(m_allocator, // NOLINT
-													   new_capacity + 1,
-													   m_allocator);
-				auto span = gsl::make_span(&temp[0], new_capacity + 1);
-				std::copy(begin(), end(), span.begin());
+				auto temp = allocate_unique<Slot[]>(m_allocator, new_capacity + 1); // NOLINT
+				const auto size_ = size();
+				for(auto i = 0_u32; i < size_; ++i) {
+					const auto index = m_state.adjusted_index(i);
+					allocator_traits::construct(m_allocator,
+												temp[i].pointer(),
+												move_if_movable(m_buffer[index].value()));
+					destroy_slot(index);
+				}
 				m_buffer = std::move(temp);
-				m_state.update(0U, capacity_, new_capacity + 1);
+				m_state.update(0U, size_, new_capacity + 1);
 			}
 		}
 
 		/// @brief Erases all elements from the `RingBuffer`
 		constexpr inline auto clear() noexcept -> void {
+			const auto size_ = size();
+			for(auto i = 0_u32; i < size_; ++i) {
+				destroy_slot(m_state.adjusted_index(i));
+			}
 			m_state.clear();
 		}
 
@@ -1777,10 +2137,7 @@ namespace hyperion {
 		///
 		/// @param value - the element to insert
 		constexpr inline auto push_back(const T& value) noexcept -> void requires Copyable<T> {
-			m_buffer[m_state.write()] // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				= Element(m_allocator, value);
-
-			m_state.increment_indices();
+			std::ignore = write_back(value);
 		}
 
 		/// @brief Inserts the given element at the end of the `RingBuffer`
@@ -1788,31 +2145,7 @@ namespace hyperion {
 		///
 		/// @param value - the element to insert
 		constexpr inline auto push_back(T&& value) noexcept -> void {
-			m_buffer[m_state.write()] // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				= Element(m_allocator, std::forward<T>(value));
-
-			m_state.increment_indices();
-		}
-
-		/// @brief Inserts the given element at the end of the `RingBuffer`
-		/// @note if `size() == capacity()` then this loops and overwrites `front()`
-		///
-		/// @param element - the element to insert
-		constexpr inline auto push_back(const Element& element) noexcept -> void {
-			m_buffer[m_state.write()] // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				= element;
-
-			m_state.increment_indices();
-		}
-
-		/// @brief Inserts the given element at the end of the `RingBuffer`
-		/// @note if `size() == capacity()` then this loops and overwrites `front()`
-		///
-		/// @param element - the element to insert
-		constexpr inline auto push_back(Element&& element) noexcept -> void {
-			m_buffer[m_state.write()] // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				= std::forward<Element>(element);
-			m_state.increment_indices();
+			std::ignore = write_back(std::forward<T>(value));
 		}
 
 		/// @brief Constructs the given element in place at the end of the `RingBuffer`
@@ -1824,18 +2157,8 @@ namespace hyperion {
 		/// @return A reference to the element constructed at the end of the `RingBuffer`
 		template<typename... Args>
 		requires ConstructibleFrom<T, Args...>
-		constexpr inline auto emplace_back(Args&&... args) noexcept -> Element {
-			const auto index = m_state.write();
-
-			allocator_traits::template construct<Element>(
-				m_allocator,
-				&m_buffer[index], // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				std::allocate_shared<T, Allocator<Element>>(m_allocator,
-															std::forward<Args>(args)...));
-
-			m_state.increment_indices();
-
-			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		constexpr inline auto emplace_back(Args&&... args) noexcept -> T& {
+			return write_back(std::forward<Args>(args)...);
 		}
 
 		/// @brief Constructs the given element in place at the location
@@ -1849,17 +2172,8 @@ namespace hyperion {
 		/// @return A reference to the element constructed at the location indicated by `position`
 		template<typename... Args>
 		requires ConstructibleFrom<T, Args...>
-		constexpr inline auto
-		emplace(const Iterator& position, Args&&... args) noexcept -> Element {
-			const auto index = m_state.get_adjusted_internal_index(position.get_index());
-
-			allocator_traits::template construct<Element>(
-				m_allocator,
-				&m_buffer[index], // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				std::allocate_shared<T, Allocator<Element>>(m_allocator,
-															std::forward<Args>(args)...));
-
-			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		constexpr inline auto emplace(const Iterator& position, Args&&... args) noexcept -> T& {
+			return emplace_internal(position.get_index(), std::forward<Args>(args)...);
 		}
 
 		/// @brief Constructs the given element in place at the location
@@ -1872,17 +2186,10 @@ namespace hyperion {
 		///
 		/// @return A reference to the element constructed at the location indicated by `position`
 		template<typename... Args>
+		requires ConstructibleFrom<T, Args...>
 		constexpr inline auto
-		emplace(const ConstIterator& position, Args&&... args) noexcept -> Element {
-			const auto index = m_state.get_adjusted_internal_index(position.get_index());
-
-			allocator_traits::template construct<Element>(
-				m_allocator,
-				&m_buffer[index], // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				std::allocate_shared<T, Allocator<Element>>(m_allocator,
-															std::forward<Args>(args)...));
-
-			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		emplace(const ConstIterator& position, Args&&... args) noexcept -> T& {
+			return emplace_internal(position.get_index(), std::forward<Args>(args)...);
 		}
 
 		/// @brief Assigns the given element to the position indicated
@@ -1893,7 +2200,7 @@ namespace hyperion {
 		/// @param element - The element to store in the `RingBuffer`
 		constexpr inline auto
 		insert(const Iterator& position, const T& element) noexcept -> void requires Copyable<T> {
-			insert_internal(position.get_index(), element);
+			std::ignore = insert_emplace_internal(position.get_index(), element);
 		}
 
 		/// @brief Assigns the given element to the position indicated
@@ -1903,7 +2210,7 @@ namespace hyperion {
 		/// @param position - `Iterator` indicating where in the `RingBuffer` to place the element
 		/// @param element - The element to store in the `RingBuffer`
 		constexpr inline auto insert(const Iterator& position, T&& element) noexcept -> void {
-			insert_internal(position.get_index(), std::forward<T>(element));
+			std::ignore = insert_emplace_internal(position.get_index(), std::forward<T>(element));
 		}
 
 		/// @brief Assigns the given element to the position indicated
@@ -1915,7 +2222,7 @@ namespace hyperion {
 		/// @param element - The element to store in the `RingBuffer`
 		constexpr inline auto insert(const ConstIterator& position, const T& element) noexcept
 			-> void requires Copyable<T> {
-			insert_internal(position.get_index(), element);
+			std::ignore = insert_emplace_internal(position.get_index(), element);
 		}
 
 		/// @brief Assigns the given element to the position indicated
@@ -1926,7 +2233,7 @@ namespace hyperion {
 		/// element
 		/// @param element - The element to store in the `RingBuffer`
 		constexpr inline auto insert(const ConstIterator& position, T&& element) noexcept -> void {
-			insert_internal(position.get_index(), std::forward<T>(element));
+			std::ignore = insert_emplace_internal(position.get_index(), std::forward<T>(element));
 		}
 
 		/// @brief Constructs the given element at the insertion position indicated
@@ -1940,7 +2247,7 @@ namespace hyperion {
 		template<typename... Args>
 		requires ConstructibleFrom<T, Args...>
 		constexpr inline auto
-		insert_emplace(const Iterator& position, Args&&... args) noexcept -> Element {
+		insert_emplace(const Iterator& position, Args&&... args) noexcept -> T& {
 			return insert_emplace_internal(position.get_index(), std::forward<Args>(args)...);
 		}
 
@@ -1955,7 +2262,7 @@ namespace hyperion {
 		template<typename... Args>
 		requires ConstructibleFrom<T, Args...>
 		constexpr inline auto
-		insert_emplace(const ConstIterator& position, Args&&... args) noexcept -> Element {
+		insert_emplace(const ConstIterator& position, Args&&... args) noexcept -> T& {
 			return insert_emplace_internal(position.get_index(), std::forward<Args>(args)...);
 		}
 
@@ -2015,20 +2322,171 @@ namespace hyperion {
 
 		/// @brief Removes the last element in the `RingBuffer` and returns it
 		///
-		/// @return The last element in the `RingBuffer`
-		[[nodiscard]] constexpr inline auto pop_back() noexcept -> Element {
-			Element back_ = back();
-			m_state.decrement_write();
-			return back_;
+		/// @return The last element in the `RingBuffer`, or `None` if the `RingBuffer` is empty
+		[[nodiscard]] inline auto pop_back() noexcept -> Option<T> {
+			while(true) {
+				const auto indices = m_state.load();
+				if(State::is_empty(indices)) {
+					return None();
+				}
+
+				const auto index = m_state.previous(State::write(indices));
+				auto& slot = m_buffer[index]; // NOLINT
+				slot.lock();
+				if(m_state.try_decrement_write(indices)) {
+					auto value = move_if_movable(slot.value());
+					destroy_slot(index);
+					slot.unlock();
+					return Some(std::move(value));
+				}
+				slot.unlock();
+			}
 		}
 
 		/// @brief Removes the first element in the `RingBuffer` and returns it
 		///
-		/// @return The first element in the `RingBuffer`
-		[[nodiscard]] constexpr inline auto pop_front() noexcept -> Element {
-			Element front_ = front();
-			m_state.increment_start();
-			return front_;
+		/// @return The first element in the `RingBuffer`, or `None` if the `RingBuffer` is empty
+		[[nodiscard]] inline auto pop_front() noexcept -> Option<T> {
+			while(true) {
+				const auto indices = m_state.load();
+				if(State::is_empty(indices)) {
+					return None();
+				}
+
+				const auto index = State::start(indices);
+				auto& slot = m_buffer[index]; // NOLINT
+				slot.lock();
+				if(m_state.try_increment_start(indices)) {
+					auto value = move_if_movable(slot.value());
+					destroy_slot(index);
+					slot.unlock();
+					return Some(std::move(value));
+				}
+				slot.unlock();
+			}
+		}
+
+		/// @brief Removes up to `destination.size()` elements from the front of the `RingBuffer`,
+		/// moving them into `destination` in order
+		///
+		/// The removed elements are claimed with a single update of the `RingBuffer`'s indices,
+		/// so draining many elements doesn't pay for a separate atomic update per element
+		///
+		/// @param destination - The span to move the removed elements into
+		///
+		/// @return The number of elements removed
+		[[nodiscard]] inline auto pop_front_n(Span<T> destination) noexcept -> index_type {
+			return take_front_n(static_cast<index_type>(destination.size()),
+								[&destination](T& value, index_type index) noexcept {
+									destination[index] = move_if_movable(value);
+								});
+		}
+
+		/// @brief Inserts copies of the given elements at the end of the `RingBuffer`, in order.
+		/// @note if this pushes past `capacity()`, the elements at the front are overwritten, as
+		/// with `push_back`
+		///
+		/// Runs of consecutive slots are claimed with a single update of the `RingBuffer`'s
+		/// indices, so pushing many elements doesn't pay for a separate atomic update per element
+		///
+		/// @param values - The elements to insert
+		inline auto push_back_n(Span<const T> values) noexcept -> void requires Copyable<T> {
+			auto num_pushed = 0_usize;
+			while(num_pushed < values.size()) {
+				const auto indices = m_state.load();
+				const auto capacity_ = m_state.capacity();
+				const auto requested = static_cast<index_type>(
+					std::min(values.size() - num_pushed, static_cast<usize>(capacity_ - 1_u32)));
+				if(requested == 0_u32) {
+					return;
+				}
+
+				const auto write_ = State::write(indices);
+				m_buffer[write_].lock(); // NOLINT
+				auto num_locked = 1_u32;
+				while(num_locked < requested
+					  && m_buffer[(write_ + num_locked) % capacity_].try_lock()) // NOLINT
+				{
+					++num_locked;
+				}
+
+				// the slots from the write index up to the start index are uninitialized, so the
+				// first of the new elements are constructed there. If there are more, they wrap
+				// around onto the elements at the front, which are still alive, so they're
+				// assigned over them, and the element in the slot after them, which becomes the
+				// one past the end, is dropped too, so its slot has to be claimed to destroy it
+				const auto size_ = m_state.size(State::start(indices), write_, capacity_);
+				const auto num_to_construct = std::min(num_locked, capacity_ - size_);
+				const auto overflows = size_ + num_locked > capacity_ - 1_u32;
+				const auto dropped = (write_ + num_locked) % capacity_;
+				auto claimed = !overflows || m_buffer[dropped].try_lock(); // NOLINT
+				if(claimed) {
+					claimed = m_state.try_increment_write_n(indices, num_locked);
+					if(overflows) {
+						if(claimed) {
+							destroy_slot(dropped);
+						}
+						m_buffer[dropped].unlock(); // NOLINT
+					}
+				}
+
+				for(auto i = 0_u32; i < num_locked; ++i) {
+					const auto index = (write_ + i) % capacity_;
+					if(claimed) {
+						const auto& value = values[num_pushed + i];
+						if(i < num_to_construct) {
+							construct_slot(index, value);
+						}
+						else {
+							m_buffer[index].value() = value; // NOLINT
+						}
+					}
+					m_buffer[index].unlock(); // NOLINT
+				}
+
+				if(claimed) {
+					num_pushed += num_locked;
+				}
+			}
+		}
+
+		/// @brief Inserts the elements of `range` at the end of the `RingBuffer`, in order.
+		/// Contiguous ranges of `T` are inserted with `push_back_n`, and other ranges element by
+		/// element
+		///
+		/// @param range - The elements to insert
+		template<std::ranges::input_range Range>
+		requires std::constructible_from<T, std::ranges::range_reference_t<Range>>
+		inline auto append(Range&& range) noexcept -> void {
+			using value_type = std::ranges::range_value_t<Range>;
+			if constexpr(std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>
+						 && concepts::Same<value_type, T> && Copyable<T>)
+			{
+				push_back_n(Span<const T>::make_span(std::ranges::data(range),
+													 std::ranges::size(range)));
+			}
+			else {
+				for(auto&& value : range) {
+					if constexpr(std::is_rvalue_reference_v<Range&&>) {
+						std::ignore = write_back(std::move(value));
+					}
+					else {
+						std::ignore = write_back(std::forward<decltype(value)>(value));
+					}
+				}
+			}
+		}
+
+		/// @brief Removes up to `n` elements from the front of the `RingBuffer` without reading
+		/// them, with a single update of the `RingBuffer`'s indices
+		///
+		/// @param n - The number of elements to remove
+		///
+		/// @return The number of elements removed
+		inline auto discard_front(index_type n) noexcept -> index_type {
+			return take_front_n(n,
+								[]([[maybe_unused]] T& value,
+								   [[maybe_unused]] index_type index) noexcept {});
 		}
 
 		/// @brief Returns a Random Access Bidirectional iterator over the `RingBuffer`,
@@ -2037,7 +2495,7 @@ namespace hyperion {
 		/// @return The iterator, at the beginning
 		[[nodiscard]] constexpr inline auto begin() -> Iterator {
 			// clang-format off
-			Element p = m_buffer[m_state.start()]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			T* p = m_buffer[m_state.start()].pointer(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 			// clang-format on
 
 			return Iterator(p, this, 0U);
@@ -2049,7 +2507,7 @@ namespace hyperion {
 		/// @return The iterator, at the end
 		[[nodiscard]] constexpr inline auto end() -> Iterator {
 			// clang-format off
-			Element p = m_buffer[m_state.write()]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			T* p = m_buffer[m_state.write()].pointer(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 			// clang-format on
 
 			return Iterator(p, this, m_state.size());
@@ -2061,7 +2519,7 @@ namespace hyperion {
 		/// @return The iterator, at the beginning
 		[[nodiscard]] constexpr inline auto cbegin() -> ConstIterator {
 			// clang-format off
-			Element p = m_buffer[m_state.start()]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			T* p = m_buffer[m_state.start()].pointer(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 			// clang-format on
 
 			return ConstIterator(p, this, 0U);
@@ -2073,7 +2531,7 @@ namespace hyperion {
 		/// @return The iterator, at the end
 		[[nodiscard]] constexpr inline auto cend() -> ConstIterator {
 			// clang-format off
-			Element p = m_buffer[m_state.write()]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			T* p = m_buffer[m_state.write()].pointer(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 			// clang-format on
 
 			return ConstIterator(p, this, m_state.size());
@@ -2084,10 +2542,10 @@ namespace hyperion {
 		/// @param index - The index to get the corresponding element for
 		///
 		/// @return - The element at index
-		[[nodiscard]] constexpr inline auto operator[](Integral auto index) noexcept -> Element {
+		[[nodiscard]] constexpr inline auto operator[](Integral auto index) noexcept -> T& {
 			const auto i = m_state.adjusted_index(static_cast<index_type>(index));
 
-			return m_buffer[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return m_buffer[i].value(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 		}
 
 		constexpr auto
@@ -2095,22 +2553,26 @@ namespace hyperion {
 			if(this == &buffer) {
 				return *this;
 			}
-			auto temp = allocate_unique<Element[]>(m_allocator, // NOLINT
-												   buffer.m_capacity,
-												   m_allocator);
-			const auto size = buffer.size();
-			for(auto i = 0_u32; i < size; ++i) {
-				temp[i]					  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-					= buffer.m_buffer[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+			if(m_buffer != nullptr) {
+				clear();
 			}
-			m_buffer = std::move(temp);
-			m_state = m_buffer.m_state;
+			m_buffer = allocate_unique<Slot[]>(m_allocator, buffer.m_state.capacity()); // NOLINT
+			m_state.update(0U, 0U, buffer.m_state.capacity());
+			copy_elements_from(buffer);
 			return *this;
 		}
 		constexpr auto operator=(RingBuffer&& buffer) noexcept -> RingBuffer& {
+			if(this == &buffer) {
+				return *this;
+			}
+
+			if(m_buffer != nullptr) {
+				clear();
+			}
 			m_allocator = buffer.m_allocator;
 			m_buffer = std::move(buffer.m_buffer);
-			m_state = m_buffer.m_state;
+			m_state = buffer.m_state;
 			buffer.m_buffer = nullptr;
 			buffer.m_state.update(0U, 0U, 0U);
 			return *this;
@@ -2134,22 +2596,22 @@ namespace hyperion {
 				: m_indices(merge_indices(start, write)), m_capacity(capacity) {
 			}
 			constexpr State(const State& state) noexcept
-				: m_indices(state.m_indices), m_capacity(state.m_capacity) {
+				: m_indices(state.m_indices.load()), m_capacity(state.m_capacity.load()) {
 			}
 			constexpr State(State&& state) noexcept
-				: m_indices(state.m_indices), m_capacity(state.m_capacity) {
+				: m_indices(state.m_indices.load()), m_capacity(state.m_capacity.load()) {
 			}
 			constexpr ~State() noexcept = default;
 
 			inline constexpr auto
 			update(index_type start, index_type write, index_type capacity) noexcept -> void {
-				auto indices = m_indices.load();
-				while(!m_indices.compare_exchange_weak(indices, merge_indices(start, write))) {
-				}
+				m_capacity.store(capacity);
+				m_indices.store(merge_indices(start, write));
+			}
 
-				auto capacity_ = m_capacity.load();
-				while(!m_capacity.compare_exchange_weak(capacity_, capacity)) {
-				}
+			/// @brief Returns a snapshot of the merged start and write indices
+			[[nodiscard]] inline auto load() const noexcept -> merged_type {
+				return m_indices.load(std::memory_order_acquire);
 			}
 
 			[[nodiscard]] inline constexpr auto start() const noexcept -> index_type {
@@ -2198,7 +2660,7 @@ namespace hyperion {
 			}
 
 			[[nodiscard]] inline constexpr auto empty() const noexcept -> bool {
-				return size() == 0_u32;
+				return is_empty(m_indices.load());
 			}
 
 			[[nodiscard]] inline constexpr auto full() const noexcept -> bool {
@@ -2212,9 +2674,7 @@ namespace hyperion {
 			}
 
 			inline constexpr auto clear() noexcept -> void {
-				auto indices = m_indices.load();
-				while(!m_indices.compare_exchange_weak(indices, merge_indices(0U, 0U))) {
-				}
+				m_indices.store(merge_indices(0U, 0U));
 			}
 
 			[[nodiscard]] inline constexpr auto
@@ -2242,71 +2702,97 @@ namespace hyperion {
 									  capacity_);
 			}
 
-			inline constexpr auto increment_indices() noexcept -> void {
-				auto indices = m_indices.load();
-				const auto capacity_ = m_capacity.load();
-				if(start(indices) == ((write(indices) + 1) % capacity_)) [[likely]] { // NOLINT
+			/// @brief Returns the internal index preceding `index`
+			[[nodiscard]] inline auto previous(index_type index) const noexcept -> index_type {
+				return index == 0U ? m_capacity.load() - 1 : index - 1;
+			}
 
-					while(!m_indices.compare_exchange_weak(
-						indices,
-						merge_indices((start(indices) + 1) % capacity_,
-									  (write(indices) + 1) % capacity_)))
-					{ }
-				}
-				else {
-					while(!(m_indices.compare_exchange_weak(
-						indices,
-						merge_indices(start(indices), (write(indices) + 1) % capacity_))))
-					{ }
-				}
+			/// @brief Attempts to advance the write index (and the start index, if full) from the
+			/// given snapshot of the indices
+			///
+			/// @return Whether the indices were updated
+			[[nodiscard]] inline auto try_increment_indices(merged_type indices) noexcept -> bool {
+				const auto capacity_ = m_capacity.load(std::memory_order_relaxed);
+				const auto start_ = start(indices);
+				const auto write_ = (write(indices) + 1) % capacity_;
+				const auto next = start_ == write_ ? merge_indices((start_ + 1) % capacity_, write_) :
+													   merge_indices(start_, write_);
+				return m_indices.compare_exchange_strong(indices, next);
+			}
+
+			/// @brief Attempts to advance the start index from the given snapshot of the indices
+			///
+			/// @return Whether the start index was updated
+			[[nodiscard]] inline auto try_increment_start(merged_type indices) noexcept -> bool {
+				const auto capacity_ = m_capacity.load(std::memory_order_relaxed);
+				return m_indices.compare_exchange_strong(
+					indices,
+					merge_indices((start(indices) + 1) % capacity_, write(indices)));
 			}
 
-			inline constexpr auto increment_start() noexcept -> void {
+			/// @brief Attempts to advance the start index by `n` from the given snapshot of the
+			/// indices
+			///
+			/// @return Whether the start index was updated
+			[[nodiscard]] inline auto
+			try_increment_start_n(merged_type indices, index_type n) noexcept -> bool {
+				const auto capacity_ = m_capacity.load(std::memory_order_relaxed);
+				return m_indices.compare_exchange_strong(
+					indices,
+					merge_indices((start(indices) + n) % capacity_, write(indices)));
+			}
+
+			/// @brief Attempts to advance the write index by `n` from the given snapshot of the
+			/// indices, advancing the start index past any elements that would be overwritten.
+			/// `n` must be less than the capacity
+			///
+			/// @return Whether the indices were updated
+			[[nodiscard]] inline auto
+			try_increment_write_n(merged_type indices, index_type n) noexcept -> bool {
+				const auto capacity_ = m_capacity.load(std::memory_order_relaxed);
+				const auto start_ = start(indices);
+				const auto write_ = write(indices);
+				const auto next_write = (write_ + n) % capacity_;
+				const auto next_start = size(start_, write_, capacity_) + n > capacity_ - 1 ?
+											  (next_write + 1) % capacity_ :
+											  start_;
+				return m_indices.compare_exchange_strong(indices,
+														 merge_indices(next_start, next_write));
+			}
+
+			/// @brief Attempts to move the write index back by one from the given snapshot of the
+			/// indices
+			///
+			/// @return Whether the write index was updated
+			[[nodiscard]] inline auto try_decrement_write(merged_type indices) noexcept -> bool {
+				return m_indices.compare_exchange_strong(
+					indices,
+					merge_indices(start(indices), previous(write(indices))));
+			}
+
+			inline constexpr auto increment_indices() noexcept -> void {
 				auto indices = m_indices.load();
-				const auto capacity_ = m_capacity.load();
-				if(start(indices) != (write(indices))) {
-					while(!(m_indices.compare_exchange_weak(
-						indices,
-						merge_indices((start(indices) + 1) % capacity_, write(indices)))))
-					{ }
+				while(!try_increment_indices(indices)) {
+					indices = m_indices.load();
 				}
 			}
 
 			inline constexpr auto decrement_write() noexcept -> void {
 				auto indices = m_indices.load();
-				if(write(indices) == 0U) {
-					const auto capacity_ = m_capacity.load();
-					while(!m_indices.compare_exchange_weak(
-						indices,
-						merge_indices(start(indices), capacity_ - 1))) {
-					}
-				}
-				else {
-					while(!m_indices.compare_exchange_weak(
-						indices,
-						merge_indices(start(indices), write(indices) - 1))) {
-					}
+				while(!try_decrement_write(indices)) {
+					indices = m_indices.load();
 				}
 			}
 
 			inline constexpr auto decrement_write_n(UnsignedIntegral auto n) noexcept -> void {
 				auto indices = m_indices.load();
 				const auto capacity_ = m_capacity.load();
-
-				auto amount_to_decrement = static_cast<index_type>(n);
-				if(amount_to_decrement > write(indices)) {
-					amount_to_decrement -= write(indices);
-					while(!m_indices.compare_exchange_weak(
-						indices,
-						merge_indices(start(indices), (capacity_ - 1) - amount_to_decrement)))
-					{ }
-				}
-				else {
-					while(!m_indices.compare_exchange_weak(
-						indices,
-						merge_indices(start(indices), write(indices) - amount_to_decrement)))
-					{ }
-				}
+				const auto amount_to_decrement = static_cast<index_type>(n);
+				while(!m_indices.compare_exchange_weak(
+					indices,
+					merge_indices(start(indices),
+								  (write(indices) + capacity_ - amount_to_decrement) % capacity_)))
+				{ }
 			}
 
 			inline constexpr auto set_write(UnsignedIntegral auto index) noexcept -> void {
@@ -2321,28 +2807,17 @@ namespace hyperion {
 				if(&state == this) {
 					return *this;
 				}
-				m_indices.store(state.m_indices);
-				m_capacity.store(state.m_capacity);
+				m_indices.store(state.m_indices.load());
+				m_capacity.store(state.m_capacity.load());
 
 				return *this;
 			}
 			constexpr auto operator=(State&& state) noexcept -> State& {
-				m_indices.store(state.m_indices);
-				m_capacity.store(state.m_capacity);
+				m_indices.store(state.m_indices.load());
+				m_capacity.store(state.m_capacity.load());
 				return *this;
 			}
 
-		  private:
-			static constexpr uint8_t START_SHIFT = 32_u32;
-			static constexpr merged_type MASK = 0x0000'0000'FFFF'FFFF_u32;
-			atomic_merged_type m_indices = 0_usize;
-			atomic_index_type m_capacity = DEFAULT_CAPACITY_INTERNAL;
-
-			[[nodiscard]] static inline constexpr auto
-			merge_indices(index_type start, index_type write) noexcept -> merged_type {
-				return (static_cast<merged_type>(start) << START_SHIFT) | write;
-			}
-
 			[[nodiscard]] static inline constexpr auto
 			start(merged_type indices) noexcept -> index_type {
 				return (indices >> START_SHIFT) & MASK;
@@ -2352,86 +2827,188 @@ namespace hyperion {
 			write(merged_type indices) noexcept -> index_type {
 				return indices & MASK;
 			}
+
+			[[nodiscard]] static inline constexpr auto
+			is_empty(merged_type indices) noexcept -> bool {
+				return start(indices) == write(indices);
+			}
+
+		  private:
+			static constexpr uint8_t START_SHIFT = 32_u32;
+			static constexpr merged_type MASK = std::numeric_limits<index_type>::max();
+			atomic_merged_type m_indices = 0_usize;
+			atomic_index_type m_capacity = DEFAULT_CAPACITY_INTERNAL;
+
+			[[nodiscard]] static inline constexpr auto
+			merge_indices(index_type start, index_type write) noexcept -> merged_type {
+				return (static_cast<merged_type>(start) << START_SHIFT) | write;
+			}
 		};
 
-		Allocator<Element> m_allocator = Allocator<Element>();
-		unique_pointer m_buffer = allocate_unique<Element[]>(m_allocator, // NOLINT
-															 DEFAULT_CAPACITY_INTERNAL,
-															 m_allocator);
+		Allocator<Slot> m_allocator = Allocator<Slot>();
+		unique_pointer m_buffer = allocate_unique<Slot[]>(m_allocator, // NOLINT
+														  DEFAULT_CAPACITY_INTERNAL);
 		State m_state = State();
 
-		/// @brief Inserts the given element at the position indicated
-		/// by the `external_index`
-		/// @note if `size() == capacity()` this drops the last element out of the `RingBuffer`
+		/// @brief Claims the slot at the end of the `RingBuffer` and constructs the new element
+		/// in it from `args`, publishing the element once it's constructed. If the `RingBuffer`
+		/// is full, the slot of the element at the front is claimed too, and the element
+		/// destroyed, as it's dropped to make room
 		///
-		/// @param external_index - The user-facing index into the `RingBuffer` to insert the
-		/// element at
-		/// @param elem - The element to store in the `RingBuffer`
-		constexpr inline auto
-		insert_internal(index_type external_index, const T& elem) noexcept -> void {
-			const auto [start, write] = m_state.indices();
-			const auto capacity_ = m_state.capacity();
-			auto index = m_state.adjusted_index(external_index, start, capacity_);
-
-			if(index == write) {
-				emplace_back(elem);
+		/// @param args - The constructor arguments for the new element
+		///
+		/// @return A reference to the new element
+		template<typename... Args>
+		inline auto write_back(Args&&... args) noexcept -> T& {
+			while(true) {
+				const auto indices = m_state.load();
+				const auto capacity_ = m_state.capacity();
+				const auto write_ = State::write(indices);
+				const auto start_ = State::start(indices);
+				const auto full_ = (write_ + 1_u32) % capacity_ == start_;
+				auto& slot = m_buffer[write_]; // NOLINT
+				slot.lock();
+				// if the front slot is held by another thread, it's likely popping it, so start
+				// over from the indices it leaves behind
+				if(full_ && !m_buffer[start_].try_lock()) { // NOLINT
+					slot.unlock();
+					continue;
+				}
+
+				const auto claimed = m_state.try_increment_indices(indices);
+				if(full_) {
+					if(claimed) {
+						destroy_slot(start_);
+					}
+					m_buffer[start_].unlock(); // NOLINT
+				}
+				if(claimed) {
+					construct_slot(write_, std::forward<Args>(args)...);
+					slot.unlock();
+					return slot.value();
+				}
+				slot.unlock();
 			}
-			else {
-				const auto size_ = m_state.size(start, write, capacity_);
-				auto num_to_move = size_ - external_index;
-				auto j = num_to_move - 1;
+		}
 
-				if(size_ == capacity_ - 1) [[likely]] { // NOLINT
-					num_to_move--;
-					j--;
-					index++;
+		/// @brief Removes up to `n` elements from the front of the `RingBuffer` with a single
+		/// update of its indices, passing each to `take`, along with its index among the removed
+		/// elements, before destroying it
+		///
+		/// @param n - The maximum number of elements to remove
+		/// @param take - Invocable receiving each removed element, as a `T&`, and its index
+		///
+		/// @return The number of elements removed
+		template<typename F>
+		inline auto take_front_n(index_type n, F&& take) noexcept -> index_type {
+			while(true) {
+				const auto indices = m_state.load();
+				const auto capacity_ = m_state.capacity();
+				const auto requested = std::min(
+					m_state.size(State::start(indices), State::write(indices), capacity_),
+					n);
+				if(requested == 0_u32) {
+					return 0_u32;
 				}
 
-				for(auto i = 0_u32; i < num_to_move; ++i, --j) {
-					m_buffer[m_state.adjusted_index(size_ - i, start, capacity_)] = std::move(
-						m_buffer[m_state.adjusted_index(external_index + j, start, capacity_)]);
+				const auto start_ = State::start(indices);
+				m_buffer[start_].lock(); // NOLINT
+				auto num_locked = 1_u32;
+				while(num_locked < requested
+					  && m_buffer[(start_ + num_locked) % capacity_].try_lock()) // NOLINT
+				{
+					++num_locked;
 				}
 
-				m_buffer[index] = Element(m_allocator, elem);
-				m_state.increment_indices();
+				const auto claimed = m_state.try_increment_start_n(indices, num_locked);
+				for(auto i = 0_u32; i < num_locked; ++i) {
+					const auto index = (start_ + i) % capacity_;
+					if(claimed) {
+						take(m_buffer[index].value(), i); // NOLINT
+						destroy_slot(index);
+					}
+					m_buffer[index].unlock(); // NOLINT
+				}
+
+				if(claimed) {
+					return num_locked;
+				}
 			}
 		}
 
-		/// @brief Inserts the given element at the position indicated
-		/// by the `external_index`
-		/// @note if `size() == capacity()` this drops the last element out of the `RingBuffer`
+		/// @brief Constructs an element in the uninitialized slot at `index`
 		///
-		/// @param external_index - The user-facing index into the `RingBuffer` to insert the
-		/// element at
-		/// @param elem - The element to store in the `RingBuffer`
-		constexpr inline auto
-		insert_internal(index_type external_index, T&& elem) noexcept -> void {
-			const auto [start, write] = m_state.indices();
-			const auto capacity_ = m_state.capacity();
-			auto index = m_state.adjusted_index(external_index, start, capacity_);
+		/// @param index - The internal index of the slot
+		/// @param args - The constructor arguments for the element
+		template<typename... Args>
+		inline auto construct_slot(index_type index, Args&&... args) noexcept -> void {
+			allocator_traits::construct(m_allocator,
+										m_buffer[index].pointer(), // NOLINT
+										std::forward<Args>(args)...);
+		}
 
-			if(index == write) {
-				emplace_back(std::forward<T>(elem));
+		/// @brief Destroys the element in the slot at `index`, leaving it uninitialized
+		///
+		/// @param index - The internal index of the slot
+		inline auto destroy_slot(index_type index) noexcept -> void {
+			if constexpr(!std::is_trivially_destructible_v<T>) {
+				allocator_traits::destroy(m_allocator, m_buffer[index].pointer()); // NOLINT
 			}
-			else {
-				const auto size_ = m_state.size(start, write, capacity_);
-				auto num_to_move = size_ - external_index;
-				auto j = num_to_move - 1;
+		}
 
-				if(size_ == capacity_ - 1) [[likely]] { // NOLINT
-					num_to_move--;
-					j--;
-					index++;
-				}
+		/// @brief Returns `value` as an rvalue if `T` is movable, so it's moved from instead of
+		/// copied
+		///
+		/// @param value - The value to move or copy from
+		///
+		/// @return `value`, as an rvalue if `T` is movable
+		[[nodiscard]] inline static auto move_if_movable(T& value) noexcept -> decltype(auto) {
+			if constexpr(Movable<T>) {
+				return std::move(value);
+			}
+			else {
+				return static_cast<const T&>(value);
+			}
+		}
 
-				for(auto i = 0_u32; i < num_to_move; ++i, --j) {
-					m_buffer[m_state.adjusted_index(size_ - i, start, capacity_)] = std::move(
-						m_buffer[m_state.adjusted_index(external_index + j, start, capacity_)]);
-				}
+		/// @brief Copy constructs the elements of `buffer` into the (uninitialized) slots of
+		/// this, which must be at least as large, from the first slot
+		///
+		/// @param buffer - The `RingBuffer` to copy from
+		inline auto copy_elements_from(const RingBuffer& buffer) noexcept -> void {
+			const auto [start, write] = buffer.m_state.indices();
+			const auto capacity_ = buffer.m_state.capacity();
+			const auto size_ = buffer.m_state.size(start, write, capacity_);
+			for(auto i = 0_u32; i < size_; ++i) {
+				construct_slot(
+					i,
+					buffer.m_buffer[buffer.m_state.adjusted_index(i, start, capacity_)].value());
+			}
+			m_state.update(0U, size_, capacity_);
+		}
 
-				m_buffer[index] = Element(m_allocator, std::forward<T>(elem));
-				m_state.increment_indices();
+		/// @brief Constructs the given element in place of the element at `external_index`, or at
+		/// the end of the `RingBuffer` if `external_index >= size()`
+		///
+		/// @param external_index - The user-facing index into the `RingBuffer` of the element to
+		/// replace
+		/// @param args - The arguments to the constructor for the element
+		///
+		/// @return A reference to the constructed element
+		template<typename... Args>
+		inline auto emplace_internal(index_type external_index, Args&&... args) noexcept -> T& {
+			// there's no element to replace past the end, so the slot there is uninitialized
+			if(external_index >= size()) {
+				return emplace_back(std::forward<Args>(args)...);
 			}
+
+			// `args` may refer to the element being replaced, so the new one is built before the
+			// old one is destroyed
+			T element(std::forward<Args>(args)...);
+			const auto index = m_state.adjusted_index(external_index);
+			destroy_slot(index);
+			construct_slot(index, move_if_movable(element));
+			return m_buffer[index].value(); // NOLINT
 		}
 
 		/// @brief Constructs the given element at the insertion position indicated
@@ -2445,38 +3022,36 @@ namespace hyperion {
 		template<typename... Args>
 		requires ConstructibleFrom<T, Args...>
 		constexpr inline auto
-		insert_emplace_internal(index_type external_index, Args&&... args) noexcept -> Element {
-			const auto [start, write] = m_state.indices();
-			const auto capacity_ = m_state.capacity();
-			auto index = m_state.adjusted_index(external_index, start, capacity_);
-
-			if(index == write) {
-				return emplace_back(std::forward<Args>(args)...);
+		insert_emplace_internal(index_type external_index, Args&&... args) noexcept -> T& {
+			// `args` may refer to an element that's moved or dropped below, so the new element is
+			// built first
+			T element(std::forward<Args>(args)...);
+
+			// if we're full, drop the last element in the buffer
+			if(full() && external_index < size()) [[likely]] { // NOLINT
+				destroy_slot(m_state.back());
+				m_state.decrement_write();
 			}
-			else {
-				const auto size_ = m_state.size(start, write, capacity_);
-				auto num_to_move = size_ - external_index;
-				auto j = num_to_move - 1;
-
-				if(size_ == capacity_ - 1) [[likely]] { // NOLINT
-					num_to_move--;
-					j--;
-					index++;
-				}
 
-				for(auto i = 0_u32; i < num_to_move; ++i, --j) {
-					m_buffer[m_state.adjusted_index(size_ - i, start, capacity_)] = std::move(
-						m_buffer[m_state.adjusted_index(external_index + j, start, capacity_)]);
-				}
+			if(external_index >= size()) {
+				return emplace_back(move_if_movable(element));
+			}
 
-				allocator_traits::template construct<Element>(
-					m_allocator,
-					&m_buffer[index],
-					std::allocate_shared<T, Allocator<Element>>(m_allocator,
-																std::forward<Args>(args)...));
-				m_state.increment_indices();
-				return m_buffer[index];
+			// the slot after the last element is uninitialized, so the last element is moved into
+			// it by construction, and the elements before it are shifted back by assignment
+			const auto size_ = size();
+			construct_slot(m_state.adjusted_index(size_),
+						   move_if_movable(m_buffer[m_state.adjusted_index(size_ - 1)].value()));
+			for(auto i = size_ - 1; i > external_index; --i) {
+				m_buffer[m_state.adjusted_index(i)].value()
+					= move_if_movable(m_buffer[m_state.adjusted_index(i - 1)].value());
 			}
+
+			const auto index = m_state.adjusted_index(external_index);
+			destroy_slot(index);
+			construct_slot(index, move_if_movable(element));
+			m_state.increment_indices();
+			return m_buffer[index].value(); // NOLINT
 		}
 
 		/// @brief Erases the element at the given index, returning an `Iterator` to the element
@@ -2488,27 +3063,7 @@ namespace hyperion {
 		/// @return `Iterator` pointing to the element after the one removed
 		[[nodiscard]] constexpr inline auto
 		erase_internal(index_type external_index) noexcept -> Iterator {
-			const auto [start, write] = m_state.indices();
-			const auto capacity_ = m_state.capacity();
-			const auto index = m_state.adjusted_index(external_index, start, capacity_);
-
-			if(index == write) [[unlikely]] { // NOLINT
-				return end();
-			}
-			else {
-				// const auto size_ = size(start, write);
-				const auto size_ = m_state.size(start, write, capacity_);
-				const auto num_to_move = (size_ - 1) - external_index;
-				const auto pos_to_move = external_index + 1;
-				const auto pos_to_replace = external_index;
-				for(auto i = 0_u32; i < num_to_move; ++i) {
-					m_buffer[m_state.adjusted_index(pos_to_replace + i, start, capacity_)]
-						= m_buffer[m_state.adjusted_index(pos_to_move + i, start, capacity_)];
-				}
-				m_state.decrement_write();
-
-				return begin() + external_index;
-			}
+			return erase_internal(external_index, external_index + 1);
 		}
 
 		/// @brief Erases the range of elements in [`first`, `last`)
@@ -2522,43 +3077,26 @@ namespace hyperion {
 		/// @return `Iterator` pointing to the element after the last one erased
 		[[nodiscard]] constexpr inline auto
 		erase_internal(index_type first, index_type last) noexcept -> Iterator { // NOLINT
-			const auto [start, write] = m_state.indices();
-			const auto capacity_ = m_state.capacity();
-			const auto size_ = m_state.size(start, write, capacity_);
-			const auto last_internal = m_state.adjusted_index(last, start, capacity_);
-			const auto num_to_remove = (last - first);
-
-			if(last_internal == write) {
-
-				if(write > start) {
-					m_state.decrement_write_n(num_to_remove);
-				}
-				else if(write < start) {
-					auto num_after_start_index
-						= (write > num_to_remove) ? write - num_to_remove : 0_u32;
-					auto num_before_start_index = num_to_remove - num_after_start_index;
-					if(num_after_start_index > 0) {
-						num_after_start_index--;
-						m_state.set_write(m_state.loop_index() - num_after_start_index);
-					}
-					else {
-						m_state.decrement_write_n(num_before_start_index);
-					}
-				}
+			const auto size_ = size();
+			if(first >= size_) [[unlikely]] { // NOLINT
 				return end();
 			}
-			else {
-				const auto num_to_move = size_ - last;
-				const auto pos_to_move = last;
-				const auto pos_to_replace = first;
-				for(auto i = 0_u32; i < num_to_move; ++i) {
-					m_buffer[m_state.adjusted_index(pos_to_replace + i, start, capacity_)]
-						= m_buffer[m_state.adjusted_index(pos_to_move + i, start, capacity_)];
-				}
-				m_state.decrement_write_n(num_to_remove);
 
-				return begin() + first;
+			const auto last_ = std::min(last, size_);
+			const auto num_to_remove = last_ - first;
+
+			// shift the elements after the range back over it, then destroy the ones left over
+			// at the end
+			for(auto i = last_; i < size_; ++i) {
+				m_buffer[m_state.adjusted_index(i - num_to_remove)].value()
+					= move_if_movable(m_buffer[m_state.adjusted_index(i)].value());
 			}
+			for(auto i = size_ - num_to_remove; i < size_; ++i) {
+				destroy_slot(m_state.adjusted_index(i));
+			}
+			m_state.decrement_write_n(num_to_remove);
+
+			return begin() + first;
 		}
 	};
 	IGNORE_PADDING_STOP
@@ -202,7 +202,7 @@ namespace hyperion {
 	#endif // _MSC_VER
 
 		[[nodiscard]] constexpr static inline auto
-		make_span(T* ptr, typename gsl::span<T>::usizeype size) noexcept -> Span<T> {
+		make_span(T* ptr, typename gsl::span<T>::size_type size) noexcept -> Span<T> {
 			return Span(gsl::make_span(ptr, size));
 		}
 
@@ -241,9 +241,10 @@ namespace hyperion {
 			return Span(gsl::make_span(container));
 		}
 
+		template<usize Count>
 		[[nodiscard]] constexpr static inline auto
-		make_span(std::array<T, Size> array) noexcept -> Span<T, Size> {
-			return Span(gsl::make_span(array));
+		make_span(std::array<T, Count>& array) noexcept -> Span<T, Count> {
+			return Span<T, Count>(gsl::make_span(array));
 		}
 
 		[[nodiscard]] constexpr inline auto operator[](usize index) noexcept -> T& {
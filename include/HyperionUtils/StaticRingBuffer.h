@@ -0,0 +1,563 @@
+/// @brief Fixed-capacity ring buffer with inline storage
+///
+/// `StaticRingBuffer` provides the core of the `RingBuffer` API for a capacity known at compile
+/// time, storing its elements in an inline array instead of allocating them
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <compare>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "BasicTypes.h"
+#include "Concepts.h"
+#include "Macros.h"
+#include "RingBuffer.h"
+#include "Span.h"
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	/// @brief A fixed-capacity, allocation-free Ring Buffer.
+	///
+	/// Elements are stored in an inline array, so a `StaticRingBuffer` can live on the stack or
+	/// be embedded directly in another type, reaching its elements doesn't go through a pointer
+	/// to separately allocated storage, and it's usable in `constexpr` contexts. Like
+	/// `RingBuffer`, pushing to a full `StaticRingBuffer` overwrites its first element.
+	///
+	/// Like `RingBufferType::NotThreadSafe`, a `StaticRingBuffer` isn't safe to share between
+	/// threads, so it isn't used to back `LockFreeQueue`, whose `QueueConcurrency::RingBuffer`
+	/// queues still hold a heap-allocated `RingBufferType::ThreadSafe` buffer. Use
+	/// `QueueConcurrency::MPMC` or `QueueConcurrency::SPSC` for a queue with inline storage.
+	///
+	/// # Iterator Invalidation
+	/// Iterators refer to elements by their index in the `StaticRingBuffer`, so are invalidated
+	/// by the same operations as `RingBuffer`'s
+	///
+	/// @tparam T - The type to store in the `StaticRingBuffer`. Must Be Default Constructible
+	/// @tparam N - The capacity of the `StaticRingBuffer`
+	template<DefaultConstructible T, usize N>
+	requires(N > 0_usize)
+	class StaticRingBuffer {
+	  private:
+		template<bool IsConst>
+		class BasicIterator;
+
+	  public:
+		/// @brief Random-Access Bidirectional iterator for `StaticRingBuffer`
+		using Iterator = BasicIterator<false>;
+		/// @brief Read-only Random-Access Bidirectional iterator for `StaticRingBuffer`
+		using ConstIterator = BasicIterator<true>;
+
+		/// @brief The capacity of the `StaticRingBuffer`
+		static constexpr usize CAPACITY = N;
+
+		/// @brief Creates an empty `StaticRingBuffer`
+		constexpr StaticRingBuffer() noexcept = default;
+		constexpr StaticRingBuffer(const StaticRingBuffer& buffer) noexcept requires Copyable<T>
+		= default;
+		constexpr StaticRingBuffer(StaticRingBuffer&& buffer) noexcept = default;
+		constexpr ~StaticRingBuffer() noexcept = default;
+
+		/// @brief Returns the element at the given index.
+		/// @note This is checked such that if `index` is out of bounds, the last element in the
+		/// `StaticRingBuffer` is returned, or, if it's empty, the (unused) slot at its front
+		///
+		/// @param index - The index of the desired element
+		///
+		/// @return The element at the given index, or the last element if index >= size()
+		[[nodiscard]] constexpr inline auto at(usize index) noexcept -> T& {
+			return m_buffer[checked_slot(index)]; // NOLINT
+		}
+
+		/// @brief Returns the element at the given index.
+		/// @note This is checked such that if `index` is out of bounds, the last element in the
+		/// `StaticRingBuffer` is returned, or, if it's empty, the (unused) slot at its front
+		///
+		/// @param index - The index of the desired element
+		///
+		/// @return The element at the given index, or the last element if index >= size()
+		[[nodiscard]] constexpr inline auto at(usize index) const noexcept -> const T& {
+			return m_buffer[checked_slot(index)]; // NOLINT
+		}
+
+		/// @brief Returns the first element in the `StaticRingBuffer`
+		///
+		/// @return The first element
+		[[nodiscard]] constexpr inline auto front() noexcept -> T& {
+			return m_buffer[m_start]; // NOLINT
+		}
+
+		/// @brief Returns the first element in the `StaticRingBuffer`
+		///
+		/// @return The first element
+		[[nodiscard]] constexpr inline auto front() const noexcept -> const T& {
+			return m_buffer[m_start]; // NOLINT
+		}
+
+		/// @brief Returns the last element in the `StaticRingBuffer`
+		///
+		/// @return The last element
+		[[nodiscard]] constexpr inline auto back() noexcept -> T& {
+			return m_buffer[slot(m_size - 1_usize)]; // NOLINT
+		}
+
+		/// @brief Returns the last element in the `StaticRingBuffer`
+		///
+		/// @return The last element
+		[[nodiscard]] constexpr inline auto back() const noexcept -> const T& {
+			return m_buffer[slot(m_size - 1_usize)]; // NOLINT
+		}
+
+		/// @brief Returns whether the `StaticRingBuffer` is empty
+		///
+		/// @return `true` if the `StaticRingBuffer` is empty, `false` otherwise
+		[[nodiscard]] constexpr inline auto empty() const noexcept -> bool {
+			return m_size == 0_usize;
+		}
+
+		/// @brief Returns whether the `StaticRingBuffer` is full
+		///
+		/// @return `true` if the `StaticRingBuffer` is full, `false` otherwise
+		[[nodiscard]] constexpr inline auto full() const noexcept -> bool {
+			return m_size == N;
+		}
+
+		/// @brief Returns the current number of elements in the `StaticRingBuffer`
+		///
+		/// @return The current number of elements
+		[[nodiscard]] constexpr inline auto size() const noexcept -> usize {
+			return m_size;
+		}
+
+		/// @brief Returns the capacity of the `StaticRingBuffer`
+		///
+		/// @return The capacity
+		[[nodiscard]] static constexpr inline auto capacity() noexcept -> usize {
+			return N;
+		}
+
+		/// @brief Erases all elements from the `StaticRingBuffer`
+		constexpr inline auto clear() noexcept -> void {
+			m_start = 0_usize;
+			m_size = 0_usize;
+		}
+
+		/// @brief Inserts the given element at the end of the `StaticRingBuffer`
+		/// @note if `full()` then this loops and overwrites `front()`
+		///
+		/// @param value - the element to insert
+		constexpr inline auto push_back(const T& value) noexcept -> void requires Copyable<T> {
+			m_buffer[slot(m_size)] = value; // NOLINT
+			increment_indices();
+		}
+
+		/// @brief Inserts the given element at the end of the `StaticRingBuffer`
+		/// @note if `full()` then this loops and overwrites `front()`
+		///
+		/// @param value - the element to insert
+		constexpr inline auto push_back(T&& value) noexcept -> void {
+			m_buffer[slot(m_size)] = std::forward<T>(value); // NOLINT
+			increment_indices();
+		}
+
+		/// @brief Constructs the given element in place at the end of the `StaticRingBuffer`
+		/// @note if `full()` then this loops and overwrites `front()`
+		///
+		/// @tparam Args - The types of the element's constructor arguments
+		/// @param args - The constructor arguments for the element
+		///
+		/// @return A reference to the element constructed at the end of the `StaticRingBuffer`
+		template<typename... Args>
+		requires ConstructibleFrom<T, Args...>
+		constexpr inline auto emplace_back(Args&&... args) noexcept -> T& {
+			m_buffer[slot(m_size)] = T(std::forward<Args>(args)...); // NOLINT
+			increment_indices();
+			return back();
+		}
+
+		/// @brief Removes the first element in the `StaticRingBuffer` and returns it
+		/// @note The `StaticRingBuffer` must not be empty
+		///
+		/// @return The first element in the `StaticRingBuffer`
+		[[nodiscard]] constexpr inline auto pop_front() noexcept -> T {
+			assert(!empty());
+			auto front_ = std::move(front());
+			m_start = wrap(m_start + 1_usize);
+			--m_size;
+			return front_;
+		}
+
+		/// @brief Removes the last element in the `StaticRingBuffer` and returns it
+		/// @note The `StaticRingBuffer` must not be empty
+		///
+		/// @return The last element in the `StaticRingBuffer`
+		[[nodiscard]] constexpr inline auto pop_back() noexcept -> T {
+			assert(!empty());
+			auto back_ = std::move(back());
+			--m_size;
+			return back_;
+		}
+
+		/// @brief Inserts copies of the given elements at the end of the `StaticRingBuffer`, in
+		/// order.
+		/// @note if this pushes past `capacity()`, the elements at the front are overwritten, as
+		/// with `push_back`
+		///
+		/// The elements are copied in at most two contiguous ranges, and the indices are only
+		/// updated once
+		///
+		/// @param values - The elements to insert
+		constexpr inline auto
+		push_back_n(Span<const T> values) noexcept -> void requires Copyable<T> {
+			// only the last `capacity()` elements would survive, so skip the rest
+			const auto num_to_push = std::min(values.size(), N);
+			const auto* source = values.data() + (values.size() - num_to_push); // NOLINT
+			// pointers into different objects can't be compared in constant expressions, so
+			// always copy there
+			if(std::is_constant_evaluated() || overlaps_storage(source, num_to_push)) {
+				// `values` may refer to elements of this `StaticRingBuffer`, which may be
+				// overwritten before they're copied, so they're copied out of it first
+				auto copies = std::array<T, N>();
+				std::copy_n(source, num_to_push, copies.begin());
+				copy_in(copies.data(), num_to_push);
+				return;
+			}
+
+			copy_in(source, num_to_push);
+		}
+
+		/// @brief Inserts the elements of `range` at the end of the `StaticRingBuffer`, in
+		/// order.
+		/// @note if this pushes past `capacity()`, the elements at the front are overwritten, as
+		/// with `push_back`
+		///
+		/// Contiguous ranges of `T` are inserted with `push_back_n`. Other ranges are inserted
+		/// element by element, moving from them if `range` is an rvalue
+		///
+		/// @param range - The elements to insert
+		template<std::ranges::input_range Range>
+		requires std::assignable_from<T&, std::ranges::range_reference_t<Range>>
+		constexpr inline auto append(Range&& range) noexcept -> void {
+			using value_type = std::ranges::range_value_t<Range>;
+			if constexpr(std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>
+						 && concepts::Same<value_type, T> && Copyable<T>)
+			{
+				push_back_n(Span<const T>::make_span(std::ranges::data(range),
+													 std::ranges::size(range)));
+			}
+			else {
+				for(auto&& value : range) {
+					if constexpr(std::is_rvalue_reference_v<Range&&>) {
+						m_buffer[slot(m_size)] = std::move(value); // NOLINT
+					}
+					else {
+						m_buffer[slot(m_size)] = std::forward<decltype(value)>(value); // NOLINT
+					}
+					increment_indices();
+				}
+			}
+		}
+
+		/// @brief Removes up to `destination.size()` elements from the front of the
+		/// `StaticRingBuffer`, moving them into `destination` in order
+		///
+		/// @param destination - The span to move the removed elements into
+		///
+		/// @return The number of elements removed
+		[[nodiscard]] constexpr inline auto pop_front_n(Span<T> destination) noexcept -> usize {
+			const auto num_to_pop = std::min(m_size, destination.size());
+			const auto num_before_wrap = std::min(num_to_pop, N - m_start);
+			auto* to = destination.data();
+			std::move(m_buffer.begin() + m_start, m_buffer.begin() + m_start + num_before_wrap, to);
+			std::move(m_buffer.begin(),
+					  m_buffer.begin() + (num_to_pop - num_before_wrap),
+					  to + num_before_wrap); // NOLINT
+
+			return discard_front(num_to_pop);
+		}
+
+		/// @brief Removes up to `n` elements from the front of the `StaticRingBuffer` without
+		/// reading them, updating the indices once
+		///
+		/// @param n - The number of elements to remove
+		///
+		/// @return The number of elements removed
+		constexpr inline auto discard_front(usize n) noexcept -> usize {
+			const auto num_to_discard = std::min(m_size, n);
+			m_start = wrap(m_start + num_to_discard);
+			m_size -= num_to_discard;
+			return num_to_discard;
+		}
+
+		/// @brief Returns the (at most) two contiguous segments of the inline storage that hold
+		/// the elements of the `StaticRingBuffer`, in order. See `RingBuffer::as_spans`
+		///
+		/// @return The segments holding the elements
+		[[nodiscard]] constexpr inline auto as_spans() noexcept -> RingBufferSpans<T> {
+			return spans_of(m_buffer.data());
+		}
+
+		/// @brief Returns the (at most) two contiguous segments of the inline storage that hold
+		/// the elements of the `StaticRingBuffer`, in order. See `RingBuffer::as_spans`
+		///
+		/// @return The segments holding the elements
+		[[nodiscard]] constexpr inline auto as_spans() const noexcept -> RingBufferSpans<const T> {
+			return spans_of(m_buffer.data());
+		}
+
+		/// @brief Returns a Random Access Bidirectional iterator over the `StaticRingBuffer`,
+		/// at the beginning
+		///
+		/// @return The iterator, at the beginning
+		[[nodiscard]] constexpr inline auto begin() noexcept -> Iterator {
+			return Iterator(this, 0_usize);
+		}
+
+		/// @brief Returns a Random Access Bidirectional iterator over the `StaticRingBuffer`,
+		/// at the end
+		///
+		/// @return The iterator, at the end
+		[[nodiscard]] constexpr inline auto end() noexcept -> Iterator {
+			return Iterator(this, m_size);
+		}
+
+		/// @brief Returns a Random Access Bidirectional read-only iterator over the
+		/// `StaticRingBuffer`, at the beginning
+		///
+		/// @return The iterator, at the beginning
+		[[nodiscard]] constexpr inline auto begin() const noexcept -> ConstIterator {
+			return ConstIterator(this, 0_usize);
+		}
+
+		/// @brief Returns a Random Access Bidirectional read-only iterator over the
+		/// `StaticRingBuffer`, at the end
+		///
+		/// @return The iterator, at the end
+		[[nodiscard]] constexpr inline auto end() const noexcept -> ConstIterator {
+			return ConstIterator(this, m_size);
+		}
+
+		/// @brief Returns a Random Access Bidirectional read-only iterator over the
+		/// `StaticRingBuffer`, at the beginning
+		///
+		/// @return The iterator, at the beginning
+		[[nodiscard]] constexpr inline auto cbegin() const noexcept -> ConstIterator {
+			return begin();
+		}
+
+		/// @brief Returns a Random Access Bidirectional read-only iterator over the
+		/// `StaticRingBuffer`, at the end
+		///
+		/// @return The iterator, at the end
+		[[nodiscard]] constexpr inline auto cend() const noexcept -> ConstIterator {
+			return end();
+		}
+
+		/// @brief Unchecked access-by-index operator
+		///
+		/// @param index - The index to get the corresponding element for
+		///
+		/// @return - The element at index
+		[[nodiscard]] constexpr inline auto operator[](usize index) noexcept -> T& {
+			return m_buffer[slot(index)]; // NOLINT
+		}
+
+		/// @brief Unchecked access-by-index operator
+		///
+		/// @param index - The index to get the corresponding element for
+		///
+		/// @return - The element at index
+		[[nodiscard]] constexpr inline auto operator[](usize index) const noexcept -> const T& {
+			return m_buffer[slot(index)]; // NOLINT
+		}
+
+		constexpr auto operator=(const StaticRingBuffer& buffer) noexcept
+			-> StaticRingBuffer& requires Copyable<T>
+		= default;
+		constexpr auto operator=(StaticRingBuffer&& buffer) noexcept -> StaticRingBuffer& = default;
+
+	  private:
+		std::array<T, N> m_buffer = {};
+		usize m_start = 0_usize;
+		usize m_size = 0_usize;
+
+		/// @brief Wraps `index`, which must be less than `2 * N`, into the storage. Compiles to a
+		/// compare and subtract instead of a division for any `N`
+		[[nodiscard]] static constexpr inline auto wrap(usize index) noexcept -> usize {
+			return index >= N ? index - N : index;
+		}
+
+		/// @brief Converts an index into the `StaticRingBuffer` into its slot in the storage
+		[[nodiscard]] constexpr inline auto slot(usize index) const noexcept -> usize {
+			return wrap(m_start + index);
+		}
+
+		/// @brief Converts an index into the `StaticRingBuffer` into its slot in the storage,
+		/// clamping it to the last element, or to the front slot if it's empty
+		[[nodiscard]] constexpr inline auto checked_slot(usize index) const noexcept -> usize {
+			return empty() ? m_start : slot(std::min(index, m_size - 1_usize));
+		}
+
+		/// @brief Returns whether `count` elements starting at `first` overlap the storage
+		[[nodiscard]] inline auto
+		overlaps_storage(const T* first, usize count) const noexcept -> bool {
+			const auto less = std::less<const T*>();
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return less(first, m_buffer.data() + N) && less(m_buffer.data(), first + count);
+		}
+
+		/// @brief Copies the `count` (at most `N`) elements starting at `source`, which must not
+		/// overlap the storage, to the end of the `StaticRingBuffer`
+		constexpr inline auto copy_in(const T* source, usize count) noexcept -> void {
+			const auto write = slot(m_size);
+			const auto num_before_wrap = std::min(count, N - write);
+			std::copy_n(source, num_before_wrap, m_buffer.begin() + write);
+			std::copy_n(source + num_before_wrap, // NOLINT
+						count - num_before_wrap,
+						m_buffer.begin());
+
+			increment_indices_n(count);
+		}
+
+		constexpr inline auto increment_indices() noexcept -> void {
+			if(m_size == N) {
+				m_start = wrap(m_start + 1_usize);
+			}
+			else {
+				++m_size;
+			}
+		}
+
+		constexpr inline auto increment_indices_n(usize n) noexcept -> void {
+			const auto num_overwritten = (m_size + n > N) ? m_size + n - N : 0_usize;
+			m_start = wrap(m_start + num_overwritten);
+			m_size += n - num_overwritten;
+		}
+
+		template<typename U>
+		[[nodiscard]] constexpr inline auto
+		spans_of(U* storage) const noexcept -> RingBufferSpans<U> {
+			const auto num_before_wrap = std::min(m_size, N - m_start);
+			return {Span<U>::make_span(storage + m_start, num_before_wrap), // NOLINT
+					Span<U>::make_span(storage, m_size - num_before_wrap)};
+		}
+
+		/// @brief Random-Access Bidirectional iterator for `StaticRingBuffer`, referring to its
+		/// element by index
+		template<bool IsConst>
+		class BasicIterator {
+		  public:
+			using iterator_category = std::random_access_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+			using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+			using container
+				= std::conditional_t<IsConst, const StaticRingBuffer*, StaticRingBuffer*>;
+
+			constexpr BasicIterator() noexcept = default;
+			constexpr BasicIterator(container containerPtr, usize currentIndex) noexcept
+				: m_container_ptr(containerPtr), m_current_index(currentIndex) {
+			}
+			constexpr BasicIterator(const BasicIterator& iter) noexcept = default;
+			constexpr BasicIterator(BasicIterator&& iter) noexcept = default;
+			constexpr ~BasicIterator() noexcept = default;
+
+			/// @brief Returns the index in the `StaticRingBuffer` that corresponds
+			/// to the element this iterator points to
+			///
+			/// @return The index corresponding with the element this points to
+			[[nodiscard]] constexpr inline auto get_index() const noexcept -> usize {
+				return m_current_index;
+			}
+
+			constexpr auto
+			operator=(const BasicIterator& iter) noexcept -> BasicIterator& = default;
+			constexpr auto operator=(BasicIterator&& iter) noexcept -> BasicIterator& = default;
+
+			constexpr inline auto operator==(const BasicIterator& rhs) const noexcept -> bool {
+				return m_current_index == rhs.m_current_index;
+			}
+
+			constexpr inline auto
+			operator<=>(const BasicIterator& rhs) const noexcept -> std::strong_ordering {
+				return m_current_index <=> rhs.m_current_index;
+			}
+
+			constexpr inline auto operator*() const noexcept -> reference {
+				return (*m_container_ptr)[m_current_index];
+			}
+
+			constexpr inline auto operator->() const noexcept -> pointer {
+				return &(*m_container_ptr)[m_current_index];
+			}
+
+			constexpr inline auto operator[](difference_type index) const noexcept -> reference {
+				return *(*this + index);
+			}
+
+			constexpr inline auto operator++() noexcept -> BasicIterator& {
+				++m_current_index;
+				return *this;
+			}
+
+			constexpr inline auto operator++(int) noexcept -> BasicIterator {
+				auto temp = *this;
+				++(*this);
+				return temp;
+			}
+
+			constexpr inline auto operator--() noexcept -> BasicIterator& {
+				--m_current_index;
+				return *this;
+			}
+
+			constexpr inline auto operator--(int) noexcept -> BasicIterator {
+				auto temp = *this;
+				--(*this);
+				return temp;
+			}
+
+			constexpr inline auto operator+=(difference_type rhs) noexcept -> BasicIterator& {
+				m_current_index = static_cast<usize>(static_cast<difference_type>(m_current_index)
+													 + rhs);
+				return *this;
+			}
+
+			constexpr inline auto operator-=(difference_type rhs) noexcept -> BasicIterator& {
+				return *this += -rhs;
+			}
+
+			constexpr inline auto operator+(difference_type rhs) const noexcept -> BasicIterator {
+				auto temp = *this;
+				return temp += rhs;
+			}
+
+			constexpr inline auto operator-(difference_type rhs) const noexcept -> BasicIterator {
+				auto temp = *this;
+				return temp -= rhs;
+			}
+
+			constexpr inline auto
+			operator-(const BasicIterator& rhs) const noexcept -> difference_type {
+				return static_cast<difference_type>(m_current_index)
+					   - static_cast<difference_type>(rhs.m_current_index);
+			}
+
+			friend constexpr inline auto
+			operator+(difference_type lhs, const BasicIterator& rhs) noexcept -> BasicIterator {
+				return rhs + lhs;
+			}
+
+		  private:
+			container m_container_ptr = nullptr;
+			usize m_current_index = 0_usize;
+		};
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
@@ -53,11 +53,9 @@ namespace hyperion::detail {
 
 		inline constexpr auto operator()(pointer p) const {
 			Alloc allocator(m_allocator);
-			auto i = N >= 1 ? N - 1 : 0;
-			do {
+			for(auto i = 0_usize; i < N; ++i) {
 				traits::destroy(allocator, std::addressof(*p) + i);
-				--i;
-			} while(i != 0);
+			}
 
 			traits::deallocate(allocator, p, N);
 		}
@@ -98,11 +96,9 @@ namespace hyperion::detail {
 
 		inline constexpr auto operator()(pointer p) const {
 			Alloc allocator(m_allocator);
-			auto i = m_num_elements >= 1 ? m_num_elements - 1 : 0;
-			do {
+			for(auto i = 0_usize; i < m_num_elements; ++i) {
 				traits::destroy(allocator, std::addressof(*p) + i);
-				--i;
-			} while(i != 0);
+			}
 
 			traits::deallocate(allocator, p, m_num_elements);
 		}
@@ -0,0 +1,34 @@
+/// @brief Uninitialized, correctly aligned storage for a single element, for containers that
+/// construct and destroy their elements explicitly
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+
+namespace hyperion::detail {
+
+	/// @brief Storage for one `T`, which isn't constructed or destroyed along with the storage.
+	/// The owner constructs the element in it with `std::construct_at` (or an allocator) at
+	/// `pointer()`, and destroys it before the storage is reused or goes away
+	///
+	/// @tparam T - The type of the element
+	template<typename T>
+	struct ElementStorage {
+		alignas(T) std::array<std::byte, sizeof(T)> m_bytes; // NOLINT
+
+		/// @brief Returns the address of the element, whether or not it's alive
+		///
+		/// @return The address of the element
+		[[nodiscard]] inline auto pointer() noexcept -> T* {
+			return reinterpret_cast<T*>(m_bytes.data()); // NOLINT
+		}
+
+		/// @brief Returns the element, which must be alive
+		///
+		/// @return The element
+		[[nodiscard]] inline auto value() noexcept -> T& {
+			return *std::launder(pointer());
+		}
+	};
+} // namespace hyperion::detail
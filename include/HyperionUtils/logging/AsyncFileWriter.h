@@ -0,0 +1,258 @@
+/// @brief Backends `AsyncFileSink` uses to write its buffers to its file without blocking the
+/// thread sinking entries
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+	#include <array>
+	#include <cerrno>
+	#include <stop_token>
+	#include <thread>
+	#include <tuple>
+
+	#include <unistd.h>
+
+	#if defined(HYPERION_USE_IO_URING) && __has_include(<liburing.h>)
+		#include <liburing.h>
+
+		/// Defined when `AsyncFileSink` can write its buffers with io_uring
+		#define HYPERION_HAS_IO_URING // NOLINT
+	#endif
+
+	#include "../BasicTypes.h"
+	#include "../LockFreeQueue.h"
+	#include "../Macros.h"
+	#include "../Monads.h"
+
+namespace hyperion::detail {
+
+	/// @brief The maximum number of buffers an `AsyncFileSink` can have
+	inline constexpr usize MAX_ASYNC_FILE_BUFFERS = 16_usize;
+
+	/// @brief A buffer submitted to be written to the file, identified by its index
+	struct AsyncFileWrite {
+		usize index = 0_usize;
+		const char* data = nullptr;
+		usize size = 0_usize;
+	};
+
+	IGNORE_PADDING_START
+	/// @brief Writes submitted buffers to a file, in order, from a dedicated thread.
+	///
+	/// Buffers are handed to the thread, and handed back once written, through single-producer
+	/// queues, so neither side takes a lock
+	class ThreadFileWriter {
+	  public:
+		ThreadFileWriter() noexcept = delete;
+		explicit ThreadFileWriter(int file) noexcept
+			: m_file(file), m_thread([this](const std::stop_token& stop) { run(stop); }) {
+		}
+		ThreadFileWriter(const ThreadFileWriter& writer) = delete;
+		ThreadFileWriter(ThreadFileWriter&& writer) = delete;
+		~ThreadFileWriter() noexcept = default;
+
+		/// @brief Submits `write` to be written after every previously submitted buffer
+		///
+		/// @param write - The buffer to write
+		inline auto submit(AsyncFileWrite write) noexcept -> void {
+			// there are never more buffers than the queue can hold, so this can't fail
+			std::ignore = m_submitted.try_push(write);
+			m_submitted.notify_pushed();
+		}
+
+		/// @brief Returns the index of a buffer that has finished being written, if there is one
+		///
+		/// @param block - Whether to wait for a buffer to finish if none have yet
+		///
+		/// @return The index of the written buffer, or `None`
+		[[nodiscard]] inline auto reap(bool block) noexcept -> Option<usize> {
+			if(block) {
+				m_completed.wait_for_entries(std::stop_token());
+			}
+			return m_completed.try_pop();
+		}
+
+		auto operator=(const ThreadFileWriter& writer) -> ThreadFileWriter& = delete;
+		auto operator=(ThreadFileWriter&& writer) -> ThreadFileWriter& = delete;
+
+	  private:
+		using SubmittedQueue = LockFreeQueue<AsyncFileWrite,
+											 QueuePolicy::ErrWhenFull,
+											 MAX_ASYNC_FILE_BUFFERS,
+											 QueueConcurrency::SPSC>;
+		using CompletedQueue = LockFreeQueue<usize,
+											 QueuePolicy::ErrWhenFull,
+											 MAX_ASYNC_FILE_BUFFERS,
+											 QueueConcurrency::SPSC>;
+
+		int m_file;
+		SubmittedQueue m_submitted = SubmittedQueue();
+		CompletedQueue m_completed = CompletedQueue();
+		// declared last so the thread is joined before the queues are destroyed
+		std::jthread m_thread;
+
+		inline auto run(const std::stop_token& stop) noexcept -> void {
+			const auto write_next = [this]() {
+				auto next = m_submitted.try_pop();
+				if(next.is_none()) {
+					return false;
+				}
+
+				const auto write = next.unwrap();
+				write_all(write);
+				std::ignore = m_completed.try_push(write.index);
+				m_completed.notify_pushed();
+				return true;
+			};
+
+			while(!stop.stop_requested()) {
+				if(!write_next()) {
+					m_submitted.wait_for_entries(stop);
+				}
+			}
+
+			// write anything submitted before we were stopped
+			while(write_next()) {
+			}
+		}
+
+		inline auto write_all(const AsyncFileWrite& write) const noexcept -> void {
+			auto written = 0_usize;
+			while(written < write.size) {
+				const auto result
+					= ::write(m_file, write.data + written, write.size - written); // NOLINT
+				if(result < 0) {
+					if(errno == EINTR) {
+						continue;
+					}
+					// the rest of the buffer is dropped
+					return;
+				}
+				written += static_cast<usize>(result);
+			}
+		}
+	};
+
+	#ifdef HYPERION_HAS_IO_URING
+	/// @brief Writes submitted buffers to a file with io_uring, keeping every submitted buffer
+	/// in flight at once.
+	///
+	/// Each buffer is written at an explicit offset, so buffers land in the file in the order
+	/// they were submitted regardless of the order they complete in. The ring is only ever
+	/// used from the thread sinking entries
+	class UringFileWriter {
+	  public:
+		UringFileWriter() noexcept = delete;
+		UringFileWriter(int file, usize queue_depth) noexcept : m_file(file) {
+			m_initialized
+				= io_uring_queue_init(static_cast<unsigned>(queue_depth), &m_ring, 0) == 0;
+		}
+		UringFileWriter(const UringFileWriter& writer) = delete;
+		UringFileWriter(UringFileWriter&& writer) = delete;
+		~UringFileWriter() noexcept {
+			if(m_initialized) {
+				while(m_in_flight != 0_usize) {
+					std::ignore = reap(true);
+				}
+				io_uring_queue_exit(&m_ring);
+			}
+		}
+
+		/// @brief Returns whether the ring was set up successfully. If it wasn't (ie: the
+		/// kernel doesn't support io_uring), this writer can't be used
+		///
+		/// @return Whether this writer can be used
+		[[nodiscard]] inline auto initialized() const noexcept -> bool {
+			return m_initialized;
+		}
+
+		/// @brief Submits `write` to be written after every previously submitted buffer
+		///
+		/// @param write - The buffer to write
+		inline auto submit(AsyncFileWrite write) noexcept -> void {
+			m_writes[write.index] = InFlight{.write = write, .offset = m_offset}; // NOLINT
+			m_offset += write.size;
+			prepare(write.index);
+		}
+
+		/// @brief Returns the index of a buffer that has finished being written, if there is one
+		///
+		/// @param block - Whether to wait for a buffer to finish if none have yet
+		///
+		/// @return The index of the written buffer, or `None`
+		[[nodiscard]] inline auto reap(bool block) noexcept -> Option<usize> {
+			while(m_in_flight != 0_usize) {
+				io_uring_cqe* completion = nullptr;
+				const auto result = block ? io_uring_wait_cqe(&m_ring, &completion) :
+											  io_uring_peek_cqe(&m_ring, &completion);
+				if(result == -EINTR) {
+					continue;
+				}
+				if(result != 0) {
+					return None();
+				}
+
+				const auto index = reinterpret_cast<usize>( // NOLINT
+					io_uring_cqe_get_data(completion));
+				const auto written = completion->res;
+				io_uring_cqe_seen(&m_ring, completion);
+				--m_in_flight;
+
+				auto& in_flight = m_writes[index]; // NOLINT
+				if(written == -EINTR || written == -EAGAIN) {
+					prepare(index);
+					continue;
+				}
+				if(written > 0 && static_cast<usize>(written) < in_flight.write.size) {
+					// short write, so submit the rest
+					in_flight.write.data += written; // NOLINT
+					in_flight.write.size -= static_cast<usize>(written);
+					in_flight.offset += static_cast<usize>(written);
+					prepare(index);
+					continue;
+				}
+				// on any other error the buffer is dropped
+				return Some(index);
+			}
+			return None();
+		}
+
+		auto operator=(const UringFileWriter& writer) -> UringFileWriter& = delete;
+		auto operator=(UringFileWriter&& writer) -> UringFileWriter& = delete;
+
+	  private:
+		struct InFlight {
+			AsyncFileWrite write = AsyncFileWrite();
+			usize offset = 0_usize;
+		};
+
+		int m_file;
+		io_uring m_ring = io_uring();
+		bool m_initialized = false;
+		usize m_in_flight = 0_usize;
+		usize m_offset = 0_usize;
+		std::array<InFlight, MAX_ASYNC_FILE_BUFFERS> m_writes = {};
+
+		inline auto prepare(usize index) noexcept -> void {
+			const auto& in_flight = m_writes[index]; // NOLINT
+			auto* submission = io_uring_get_sqe(&m_ring);
+			// the ring has an entry per buffer, so this only happens if submitting failed before
+			while(submission == nullptr) {
+				io_uring_submit(&m_ring);
+				submission = io_uring_get_sqe(&m_ring);
+			}
+			io_uring_prep_write(submission,
+								m_file,
+								in_flight.write.data,
+								static_cast<unsigned>(in_flight.write.size),
+								static_cast<u64>(in_flight.offset));
+			io_uring_sqe_set_data(submission, reinterpret_cast<void*>(index)); // NOLINT
+			io_uring_submit(&m_ring);
+			++m_in_flight;
+		}
+	};
+	#endif
+	IGNORE_PADDING_STOP
+} // namespace hyperion::detail
+
+#endif
@@ -0,0 +1,378 @@
+/// @brief The compact binary log format written by `BinaryFileSink`, and its decoder
+///
+/// A binary log starts with `binary_log::MAGIC`, followed by a sequence of records. Each record
+/// starts with a `binary_log::RecordKind` byte:
+///
+/// - `Format`: registers a format string: u32 id, u32 length, the format string's bytes.
+/// 			Written the first time an entry using the format string is written to the file,
+/// 			so every later entry using it only refers to it by id
+/// - `Entry`: an entry that was formatted from a registered format string: u32 format id,
+/// 		   u8 `LogLevel`, u64 thread id, i64 nanoseconds since the `system_clock` epoch,
+/// 		   u8 argument count, then each argument as a `binary_log::ArgumentType` byte followed
+/// 		   by its value
+/// - `Text`: an entry that was already formatted: u8 `LogLevel`, u32 length, the entry's text
+///
+/// Values are written in the native byte order of the machine that wrote the log
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "../BasicTypes.h"
+#include "../Concepts.h"
+#include "../Error.h"
+#include "../Macros.h"
+#include "../Monads.h"
+#include "Config.h"
+#include "TimeStamp.h"
+#include "fmtIncludes.h"
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	IGNORE_WEAK_VTABLES_START
+	/// @brief Error type for communicating failures to decode a binary log
+	class BinaryLogError final : public Error {
+	  public:
+		BinaryLogError() noexcept {
+			Error::m_message = "Error decoding binary log"s;
+		}
+		explicit BinaryLogError(const std::string& message) noexcept : Error(message) {
+		}
+		explicit BinaryLogError(std::string&& message) noexcept
+			: Error(std::forward<std::string>(message)) {
+		}
+		BinaryLogError(const BinaryLogError& error) noexcept = default;
+		BinaryLogError(BinaryLogError&& error) noexcept = default;
+		~BinaryLogError() noexcept final = default;
+
+		auto operator=(const BinaryLogError& error) noexcept -> BinaryLogError& = default;
+		auto operator=(BinaryLogError&& error) noexcept -> BinaryLogError& = default;
+	};
+	IGNORE_WEAK_VTABLES_STOP
+	IGNORE_PADDING_STOP
+
+	namespace binary_log {
+
+		/// @brief The bytes every binary log starts with
+		inline constexpr std::string_view MAGIC = "HYPLOG01";
+
+		/// @brief The kinds of records in a binary log
+		enum class RecordKind : u8
+		{
+			Format = 0,
+			Entry = 1,
+			Text = 2
+		};
+
+		/// @brief How an argument of an `Entry` record is stored
+		enum class ArgumentType : u8
+		{
+			/// @brief A u8 that is 0 or 1
+			Bool = 0,
+			/// @brief A single char
+			Char = 1,
+			/// @brief Any signed integer, widened to i64
+			Signed = 2,
+			/// @brief Any unsigned integer, widened to u64
+			Unsigned = 3,
+			/// @brief A float
+			Float = 4,
+			/// @brief A double, or a long double narrowed to double
+			Double = 5,
+			/// @brief Any other type, formatted with "{}" when the entry was written: u32
+			/// length, then the formatted text
+			String = 6
+		};
+
+		/// @brief Appends the raw bytes of `value` to `buffer`
+		///
+		/// @param buffer - The buffer to append to
+		/// @param value - The value to append
+		template<typename T>
+		requires std::is_trivially_copyable_v<T>
+		inline auto write(fmt::memory_buffer& buffer, const T& value) noexcept -> void {
+			const auto* const bytes = reinterpret_cast<const char*>(&value); // NOLINT
+			buffer.append(bytes, bytes + sizeof(T));						 // NOLINT
+		}
+
+		/// @brief Appends `string` to `buffer`, prefixed by its u32 length
+		///
+		/// @param buffer - The buffer to append to
+		/// @param string - The string to append
+		inline auto write_string(fmt::memory_buffer& buffer, std::string_view string) noexcept
+			-> void {
+			write(buffer, static_cast<u32>(string.size()));
+			buffer.append(string.data(), string.data() + string.size()); // NOLINT
+		}
+
+		/// @brief Appends `arg`, tagged with its `ArgumentType`, to `buffer`
+		///
+		/// Arithmetic types are stored as-is, so they can be formatted with the same format
+		/// specification when the log is decoded. Anything else is formatted with "{}" and stored
+		/// as a string
+		///
+		/// @param buffer - The buffer to append to
+		/// @param arg - The argument to append
+		template<typename T>
+		inline auto write_argument(fmt::memory_buffer& buffer, const T& arg) noexcept -> void {
+			if constexpr(concepts::Same<T, bool>) {
+				write(buffer, ArgumentType::Bool);
+				write(buffer, static_cast<u8>(arg));
+			}
+			else if constexpr(concepts::Same<T, char>) {
+				write(buffer, ArgumentType::Char);
+				write(buffer, arg);
+			}
+			else if constexpr(std::is_integral_v<T> && std::is_signed_v<T>) {
+				write(buffer, ArgumentType::Signed);
+				write(buffer, static_cast<i64>(arg));
+			}
+			else if constexpr(std::is_integral_v<T>) {
+				write(buffer, ArgumentType::Unsigned);
+				write(buffer, static_cast<u64>(arg));
+			}
+			else if constexpr(concepts::Same<T, float>) {
+				write(buffer, ArgumentType::Float);
+				write(buffer, arg);
+			}
+			else if constexpr(std::is_floating_point_v<T>) {
+				write(buffer, ArgumentType::Double);
+				write(buffer, static_cast<double>(arg));
+			}
+			else {
+				auto formatted = fmt::memory_buffer();
+				fmt::format_to(std::back_inserter(formatted), "{}", arg);
+				write(buffer, ArgumentType::String);
+				write_string(buffer, std::string_view(formatted.data(), formatted.size()));
+			}
+		}
+
+		IGNORE_PADDING_START
+		/// @brief Reads values from a binary log, front to back
+		class Reader {
+		  public:
+			explicit Reader(std::string_view data) noexcept : m_data(data) {
+			}
+
+			/// @brief Returns whether everything has been read
+			///
+			/// @return Whether the reader is at the end of the data
+			[[nodiscard]] inline auto at_end() const noexcept -> bool {
+				return m_position == m_data.size();
+			}
+
+			/// @brief Reads a `T` into `value`
+			///
+			/// @param value - The value to read into
+			///
+			/// @return Whether there were enough bytes left to read a `T`
+			template<typename T>
+			requires std::is_trivially_copyable_v<T>
+			[[nodiscard]] inline auto read(T& value) noexcept -> bool {
+				if(m_data.size() - m_position < sizeof(T)) {
+					return false;
+				}
+				std::memcpy(&value, m_data.data() + m_position, sizeof(T)); // NOLINT
+				m_position += sizeof(T);
+				return true;
+			}
+
+			/// @brief Reads a length-prefixed string into `string`. `string` views the data
+			/// being read
+			///
+			/// @param string - The string to read into
+			///
+			/// @return Whether the whole string could be read
+			[[nodiscard]] inline auto read_string(std::string_view& string) noexcept -> bool {
+				auto length = 0_u32;
+				if(!read(length) || m_data.size() - m_position < length) {
+					return false;
+				}
+				string = m_data.substr(m_position, length);
+				m_position += length;
+				return true;
+			}
+
+		  private:
+			std::string_view m_data;
+			usize m_position = 0_usize;
+		};
+		IGNORE_PADDING_STOP
+
+		/// @brief Reads a `LogLevel` byte into `level`, checking it's the level of an entry
+		///
+		/// @return Whether a valid `LogLevel` could be read
+		[[nodiscard]] inline auto read_level(Reader& reader, LogLevel& level) noexcept -> bool {
+			auto raw = u8(0);
+			if(!reader.read(raw) || raw > static_cast<u8>(LogLevel::ERROR)) {
+				return false;
+			}
+			level = static_cast<LogLevel>(raw);
+			return true;
+		}
+
+		/// @brief Reads an argument written by `write_argument` into `args`
+		///
+		/// @return Whether the argument could be read
+		[[nodiscard]] inline auto
+		read_argument(Reader& reader,
+					  fmt::dynamic_format_arg_store<fmt::format_context>& args) noexcept -> bool {
+			auto type = ArgumentType::String;
+			if(!reader.read(type)) {
+				return false;
+			}
+
+			const auto push = [&]<typename T>(T value) {
+				if(!reader.read(value)) {
+					return false;
+				}
+				args.push_back(value);
+				return true;
+			};
+
+			switch(type) {
+				case ArgumentType::Bool: {
+					auto value = u8(0);
+					if(!reader.read(value)) {
+						return false;
+					}
+					args.push_back(value != 0);
+					return true;
+				}
+				case ArgumentType::Char: return push(char(0));
+				case ArgumentType::Signed: return push(i64(0));
+				case ArgumentType::Unsigned: return push(u64(0));
+				case ArgumentType::Float: return push(0.0F);
+				case ArgumentType::Double: return push(0.0);
+				case ArgumentType::String: {
+					auto value = std::string_view();
+					if(!reader.read_string(value)) {
+						return false;
+					}
+					args.push_back(fmt::string_view(value.data(), value.size()));
+					return true;
+				}
+				default: return false;
+			}
+		}
+
+		/// @brief Decodes the binary log in `data`, appending each of its entries to `output` as
+		/// text, in the same layout a `Logger` writes text entries in.
+		///
+		/// # Errors
+		/// Returns an error if `data` isn't a binary log, or if it contains a malformed or
+		/// truncated record (ie: the last record of a log whose writer crashed), including an
+		/// entry whose arguments don't match its format string. Entries decoded before the bad
+		/// record are still appended to `output`
+		///
+		/// @tparam Precision - The precision to render the entries' time stamps with
+		/// @param data - The binary log to decode
+		/// @param output - The buffer to append the decoded entries to
+		///
+		/// @return The number of entries decoded on success, `BinaryLogError` on error
+		template<LogTimeStampPrecision Precision = LogTimeStampPrecision::Seconds>
+		[[nodiscard]] inline auto
+		decode(std::string_view data, fmt::memory_buffer& output) noexcept
+			-> Result<usize, BinaryLogError> {
+			if(!data.starts_with(MAGIC)) {
+				return Err(BinaryLogError("Data is not a binary log"s));
+			}
+
+			auto reader = Reader(data.substr(MAGIC.size()));
+			auto formats = std::unordered_map<u32, std::string_view>();
+			auto args = fmt::dynamic_format_arg_store<fmt::format_context>();
+			auto num_entries = 0_usize;
+			const auto truncated = [&num_entries]() {
+				return Err(BinaryLogError(
+					fmt::format("Malformed or truncated record after {} entries", num_entries)));
+			};
+
+			while(!reader.at_end()) {
+				auto kind = RecordKind::Text;
+				if(!reader.read(kind)) {
+					return truncated();
+				}
+
+				if(kind == RecordKind::Format) {
+					auto id = 0_u32;
+					auto format_string = std::string_view();
+					if(!reader.read(id) || !reader.read_string(format_string)) {
+						return truncated();
+					}
+					formats[id] = format_string;
+				}
+				else if(kind == RecordKind::Entry) {
+					auto id = 0_u32;
+					auto level = LogLevel::MESSAGE;
+					auto thread_id = 0_u64;
+					auto nanoseconds = i64(0);
+					auto num_args = u8(0);
+					if(!reader.read(id) || !read_level(reader, level) || !reader.read(thread_id)
+					   || !reader.read(nanoseconds) || !reader.read(num_args))
+					{
+						return truncated();
+					}
+
+					const auto format_string = formats.find(id);
+					if(format_string == formats.end()) {
+						return Err(BinaryLogError(
+							fmt::format("Entry {} uses unregistered format id {}", num_entries, id)));
+					}
+
+					args.clear();
+					for(auto i = u8(0); i < num_args; ++i) {
+						if(!read_argument(reader, args)) {
+							return truncated();
+						}
+					}
+
+					const auto time = std::chrono::system_clock::time_point(
+						std::chrono::duration_cast<std::chrono::system_clock::duration>(
+							std::chrono::nanoseconds(nanoseconds)));
+					const auto entry_start = output.size();
+					fmt::format_to(std::back_inserter(output),
+								   "{0}  [Thread ID: {1}] [{2}]: ",
+								   TimeStampCache::instance().time_stamp<Precision>(time).view(),
+								   thread_id,
+								   log_level_name(level));
+					try {
+						fmt::vformat_to(std::back_inserter(output),
+										fmt::string_view(format_string->second.data(),
+														 format_string->second.size()),
+										args);
+					}
+					catch(const fmt::format_error& error) {
+						output.resize(entry_start);
+						return Err(BinaryLogError(
+							fmt::format("Entry {} doesn't match its format string: {}",
+										num_entries,
+										error.what())));
+					}
+					output.push_back('\n');
+					++num_entries;
+				}
+				else if(kind == RecordKind::Text) {
+					auto level = LogLevel::MESSAGE;
+					auto text = std::string_view();
+					if(!read_level(reader, level) || !reader.read_string(text)) {
+						return truncated();
+					}
+					output.append(text.data(), text.data() + text.size()); // NOLINT
+					++num_entries;
+				}
+				else {
+					return truncated();
+				}
+			}
+
+			return Ok(num_entries);
+		}
+	} // namespace binary_log
+} // namespace hyperion
@@ -0,0 +1,220 @@
+/// @brief Per-call-site rate limiting and sampling for log statements
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <source_location>
+#include <type_traits>
+#include <utility>
+
+#include "../BasicTypes.h"
+#include "../Macros.h"
+
+namespace hyperion {
+
+	class CallSiteRegistry;
+
+	IGNORE_PADDING_START
+	/// @brief The rate limiting and sampling state of a single log statement, identified by its
+	/// `std::source_location`.
+	///
+	/// A `CallSite` is created as a `constinit` static by `HYPERION_LOG_LIMITED` (and the macros
+	/// built on it), so each statement using those macros gets its own. Whether an entry from the
+	/// statement should be logged is decided with a few relaxed atomic operations, before any of
+	/// its arguments are evaluated or formatted.
+	///
+	/// `CallSite`s are trivially destructible, so the message thread of a `Logger` that outlives
+	/// them (ie: a global `Logger`) can still safely report on them during static destruction
+	class CallSite {
+	  public:
+		/// @brief Constructs a `CallSite` for the statement at `location`
+		///
+		/// @param location - The location of the log statement
+		/// @param max_per_second - The most entries to log from the statement per second, or 0
+		/// for no limit
+		/// @param sample_one_in - Only log one in every this many entries from the statement.
+		/// 1 (or 0) logs every entry
+		explicit constexpr CallSite(std::source_location location,
+									u32 max_per_second,
+									u32 sample_one_in) noexcept
+			: m_location(location), m_max_per_second(max_per_second),
+			  m_sample_one_in(sample_one_in) {
+		}
+		CallSite(const CallSite& site) = delete;
+		CallSite(CallSite&& site) = delete;
+		~CallSite() noexcept = default;
+
+		/// @brief Returns whether the next entry from this statement should be logged. If it
+		/// shouldn't, it's counted as suppressed, and this site is registered with `registry`,
+		/// if it isn't already, so the suppression gets reported
+		///
+		/// @param registry - The registry of the `Logger` the statement logs to
+		///
+		/// @return Whether to log the entry
+		[[nodiscard]] inline auto should_log(CallSiteRegistry& registry) noexcept -> bool;
+
+		/// @brief Returns the location of the statement
+		///
+		/// @return The location of the statement
+		[[nodiscard]] inline constexpr auto
+		location() const noexcept -> const std::source_location& {
+			return m_location;
+		}
+
+		/// @brief Returns the number of entries suppressed since the last call, resetting it
+		///
+		/// @return The number of entries suppressed
+		[[nodiscard]] inline auto take_suppressed() noexcept -> u64 {
+			return m_suppressed.exchange(0_u64, std::memory_order_relaxed);
+		}
+
+		auto operator=(const CallSite& site) -> CallSite& = delete;
+		auto operator=(CallSite&& site) -> CallSite& = delete;
+
+	  private:
+		std::source_location m_location;
+		u32 m_max_per_second;
+		u32 m_sample_one_in;
+		std::atomic<u64> m_num_sampled = 0_u64;
+		// the current one-second window in the upper 32 bits, and the number of entries logged in
+		// it in the lower 32, so both can be updated together
+		std::atomic<u64> m_window = 0_u64;
+		std::atomic<u64> m_suppressed = 0_u64;
+		// the id of the registry this was last registered with, or 0 if it hasn't been. Ids
+		// aren't reused, unlike the addresses of destroyed registries
+		std::atomic<u64> m_registry_id = 0_u64;
+
+		[[nodiscard]] inline auto sampled() noexcept -> bool {
+			if(m_sample_one_in <= 1_u32) {
+				return true;
+			}
+			return m_num_sampled.fetch_add(1_u64, std::memory_order_relaxed) % m_sample_one_in
+				   == 0_u64;
+		}
+
+		[[nodiscard]] inline auto within_rate() noexcept -> bool {
+			if(m_max_per_second == 0_u32) {
+				return true;
+			}
+
+			const auto window = static_cast<u64>(static_cast<u32>(
+				std::chrono::duration_cast<std::chrono::seconds>(
+					std::chrono::steady_clock::now().time_since_epoch())
+					.count()));
+			auto state = m_window.load(std::memory_order_relaxed);
+			while(true) {
+				const auto same_window = (state >> 32U) == window;
+				if(same_window && (state & 0xFFFFFFFFU) >= m_max_per_second) {
+					return false;
+				}
+
+				const auto next = same_window ? state + 1_u64 : (window << 32U) | 1_u64;
+				if(m_window.compare_exchange_weak(state, next, std::memory_order_relaxed)) {
+					return true;
+				}
+			}
+		}
+
+	};
+	IGNORE_PADDING_STOP
+
+	static_assert(std::is_trivially_destructible_v<CallSite>,
+				  "CallSite must be trivially destructible so it outlives every Logger");
+
+	IGNORE_PADDING_START
+	/// @brief The `CallSite`s that have suppressed entries logged to a `Logger`, so its message
+	/// thread can report how many entries each suppressed.
+	///
+	/// Sites are added to a lock-free list and never removed. A site can be in the registries of
+	/// several `Logger`s: it's added to a `Logger`'s registry when it suppresses an entry for
+	/// that `Logger` and was last registered with another (or none), so a statement logging to
+	/// a `Logger` created after an earlier one was destroyed, or to more than one `Logger`, is
+	/// still reported. Its suppressed entries are reported by whichever `Logger` takes them first
+	class CallSiteRegistry {
+	  public:
+		CallSiteRegistry() noexcept = default;
+		CallSiteRegistry(const CallSiteRegistry& registry) = delete;
+		CallSiteRegistry(CallSiteRegistry&& registry) = delete;
+		~CallSiteRegistry() noexcept {
+			auto* node = m_head.load(std::memory_order_acquire);
+			while(node != nullptr) {
+				delete std::exchange(node, node->next); // NOLINT(cppcoreguidelines-owning-memory)
+			}
+		}
+
+		/// @brief Returns the id of this registry, unique among all registries
+		///
+		/// @return The id
+		[[nodiscard]] inline auto id() const noexcept -> u64 {
+			return m_id;
+		}
+
+		/// @brief Adds `site` to the registry, unless it's already in it
+		///
+		/// @param site - The site to add
+		inline auto add(CallSite& site) noexcept -> void {
+			auto contains = false;
+			for_each([&site, &contains](const CallSite& added) { contains |= &added == &site; });
+			if(contains) {
+				return;
+			}
+
+			auto* node = new Node{&site, m_head.load(std::memory_order_relaxed)}; // NOLINT
+			while(!m_head.compare_exchange_weak(node->next,
+												node,
+												std::memory_order_release,
+												std::memory_order_relaxed))
+			{
+			}
+		}
+
+		/// @brief Returns whether no sites have been added to the registry
+		///
+		/// @return Whether the registry is empty
+		[[nodiscard]] inline auto empty() const noexcept -> bool {
+			return m_head.load(std::memory_order_relaxed) == nullptr;
+		}
+
+		/// @brief Calls `function` with each site in the registry
+		///
+		/// @param function - The function to call, with the signature `(CallSite& site)`
+		template<typename Function>
+		inline auto for_each(Function&& function) const noexcept -> void {
+			for(auto* node = m_head.load(std::memory_order_acquire); node != nullptr;
+				node = node->next) {
+				function(*node->site);
+			}
+		}
+
+		auto operator=(const CallSiteRegistry& registry) -> CallSiteRegistry& = delete;
+		auto operator=(CallSiteRegistry&& registry) -> CallSiteRegistry& = delete;
+
+	  private:
+		struct Node {
+			CallSite* site;
+			Node* next;
+		};
+
+		static inline std::atomic<u64> s_next_id = 1_u64; // NOLINT
+
+		u64 m_id = s_next_id.fetch_add(1_u64, std::memory_order_relaxed);
+		std::atomic<Node*> m_head = nullptr;
+	};
+	IGNORE_PADDING_STOP
+
+	inline auto CallSite::should_log(CallSiteRegistry& registry) noexcept -> bool {
+		if(sampled() && within_rate()) {
+			return true;
+		}
+
+		m_suppressed.fetch_add(1_u64, std::memory_order_relaxed);
+		// only the thread that switches the site over to `registry` adds it
+		const auto id = registry.id();
+		if(m_registry_id.load(std::memory_order_relaxed) != id
+		   && m_registry_id.exchange(id, std::memory_order_relaxed) != id)
+		{
+			registry.add(*this);
+		}
+		return false;
+	}
+} // namespace hyperion
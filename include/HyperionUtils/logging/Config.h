@@ -2,6 +2,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string_view>
 
 #include "../Concepts.h"
 
@@ -24,6 +25,22 @@ namespace hyperion {
 		DISABLED = 5
 	};
 
+	/// @brief Returns the name of `level`, as written in log entries
+	///
+	/// @param level - The level to get the name of
+	///
+	/// @return The name of `level`
+	[[nodiscard]] inline constexpr auto log_level_name(LogLevel level) noexcept -> std::string_view {
+		switch(level) {
+			case LogLevel::MESSAGE: return "MESSAGE";
+			case LogLevel::TRACE: return "TRACE";
+			case LogLevel::INFO: return "INFO";
+			case LogLevel::WARN: return "WARN";
+			case LogLevel::ERROR: return "ERROR";
+			default: return "";
+		}
+	}
+
 	/// @brief Used to indicate the behavior of the logger when
 	/// queueing an entry for logging. This is the behavior the user will experience
 	/// when calling `log` or one of the logging-level-specific methods.
@@ -35,7 +52,8 @@ namespace hyperion {
 	/// 					   and when full, entries not yet logged to disk will be
 	/// 					   overwritten and discarded
 	/// - `FlushWhenFull`: The logger will block when the logging queue is full
-	/// 				   until the queue is empty again
+	/// 				   until the logger's background thread frees space in it, or until
+	/// 				   the logger's flush timeout (if it has one) elapses
 	enum class LogPolicy : uint8_t
 	{
 		/// @brief The logger will return an error when the logging queue is full
@@ -44,8 +62,8 @@ namespace hyperion {
 		/// @brief The logger's queue will act as a ring buffer, and when full,
 		/// entries not yet logged to disk will be overwritten and discarded
 		OverwriteWhenFull = 1,
-		/// @brief The logger will block when the loggign queue is full,
-		/// until the queue is empty again
+		/// @brief The logger will block when the logging queue is full,
+		/// until there is space in it again
 		FlushWhenFull = 2
 	};
 
@@ -83,15 +101,127 @@ namespace hyperion {
 	/// @brief Alias for the default logging level
 	using DefaultLogLevel = LoggerLevel<>;
 
+	/// @brief Used to indicate how entries are buffered between the threads logging them and the
+	/// logger's background thread.
+	///
+	/// - `Shared`: Every thread pushes to a single queue shared by the whole logger
+	/// - `PerThread`: Each thread pushes to its own single-producer queue, registered with the
+	/// 			   logger the first time that thread logs. The logger's background thread
+	/// 			   drains the queues round-robin, so threads logging concurrently don't contend
+	/// 			   with each other. Entries from a single thread are written in order, but
+	/// 			   entries from different threads may be interleaved differently than they
+	/// 			   were logged
+	enum class LogBuffering : uint8_t
+	{
+		/// @brief Every thread pushes to a single queue shared by the whole logger
+		Shared = 0,
+		/// @brief Each thread pushes to its own queue, drained round-robin by the logger
+		PerThread = 1
+	};
+
+	/// @brief Wrapper type for `LogBuffering` for type-safe compile-time logger configuration
+	///
+	/// @tparam Buffering - The `LogBuffering` to use for the logger
+	template<LogBuffering Buffering = LogBuffering::Shared>
+	struct LoggerBuffering {
+		static constexpr LogBuffering buffering = Buffering;
+	};
+
+	/// @brief Concept that requires `T` to be a `LoggerBuffering` type
+	template<typename T>
+	concept LoggerBufferingType = requires() {
+		T::buffering;
+	};
+
+	/// @brief Alias for the default logging buffering
+	using DefaultLogBuffering = LoggerBuffering<>;
+
+	/// @brief Used to indicate where log entries are formatted.
+	///
+	/// - `Immediate`: Entries are formatted, and their timestamp rendered, on the thread logging
+	/// 			   them, before they are queued
+	/// - `Deferred`: The thread logging an entry only captures its format string, arguments, and
+	/// 			  a raw timestamp; formatting and timestamp rendering happen on the logger's
+	/// 			  background thread. Only entries whose format string is checked at compile
+	/// 			  time (created with `FMT_STRING`) and whose arguments are all values that own
+	/// 			  what they format (arithmetic types and enums, or types opted in with
+	/// 			  `is_deferrable_argument`; never pointers, spans, or views, which might dangle
+	/// 			  by the time they're formatted) that fit in
+	/// 			  `DeferredEntry::ARGUMENTS_CAPACITY` bytes are deferred; anything else is
+	/// 			  still formatted immediately
+	enum class LogFormatting : uint8_t
+	{
+		/// @brief Entries are formatted on the thread logging them
+		Immediate = 0,
+		/// @brief Entries are formatted on the logger's background thread, when possible
+		Deferred = 1
+	};
+
+	/// @brief Wrapper type for `LogFormatting` for type-safe compile-time logger configuration
+	///
+	/// @tparam Formatting - The `LogFormatting` to use for the logger
+	template<LogFormatting Formatting = LogFormatting::Immediate>
+	struct LoggerFormatting {
+		static constexpr LogFormatting formatting = Formatting;
+	};
+
+	/// @brief Concept that requires `T` to be a `LoggerFormatting` type
+	template<typename T>
+	concept LoggerFormattingType = requires() {
+		T::formatting;
+	};
+
+	/// @brief Alias for the default logging formatting
+	using DefaultLogFormatting = LoggerFormatting<>;
+
+	/// @brief Used to indicate the precision of the time stamps prepended to log entries.
+	/// Sub-second precision is appended after the seconds, ie: [2021-08-10|12-30-15.125]
+	enum class LogTimeStampPrecision : uint8_t
+	{
+		/// @brief Time stamps are precise to the second
+		Seconds = 0,
+		/// @brief Time stamps are precise to the millisecond
+		Milliseconds = 1,
+		/// @brief Time stamps are precise to the microsecond
+		Microseconds = 2
+	};
+
+	/// @brief Wrapper type for `LogTimeStampPrecision` for type-safe compile-time logger
+	/// configuration
+	///
+	/// @tparam Precision - The `LogTimeStampPrecision` to use for the logger
+	template<LogTimeStampPrecision Precision = LogTimeStampPrecision::Seconds>
+	struct LoggerTimeStampPrecision {
+		static constexpr LogTimeStampPrecision time_stamp_precision = Precision;
+	};
+
+	/// @brief Concept that requires `T` to be a `LoggerTimeStampPrecision` type
+	template<typename T>
+	concept LoggerTimeStampPrecisionType = requires() {
+		T::time_stamp_precision;
+	};
+
+	/// @brief Alias for the default logging time stamp precision
+	using DefaultLogTimeStampPrecision = LoggerTimeStampPrecision<>;
+
 	/// @brief Wrapper type for type-safe compile-time passing of logging configuration parameters
 	///
 	/// @tparam PolicyType - The policy to use for the logger
 	/// @tparam MinimumLevelType - The minimum logging level for the logger
+	/// @tparam BufferingType - How entries are buffered before being written
+	/// @tparam FormattingType - Where entries are formatted
+	/// @tparam TimeStampPrecisionType - The precision of entries' time stamps
 	template<LoggerPolicyType PolicyType = DefaultLogPolicy,
-			 LoggerLevelType MinimumLevelType = DefaultLogLevel>
+			 LoggerLevelType MinimumLevelType = DefaultLogLevel,
+			 LoggerBufferingType BufferingType = DefaultLogBuffering,
+			 LoggerFormattingType FormattingType = DefaultLogFormatting,
+			 LoggerTimeStampPrecisionType TimeStampPrecisionType = DefaultLogTimeStampPrecision>
 	struct LoggerParameters {
 		static constexpr auto policy = PolicyType::policy;
 		static constexpr auto minimum_level = MinimumLevelType::minimum_level;
+		static constexpr auto buffering = BufferingType::buffering;
+		static constexpr auto formatting = FormattingType::formatting;
+		static constexpr auto time_stamp_precision = TimeStampPrecisionType::time_stamp_precision;
 	};
 
 	/// @brief Concept that requires `T` to be a `LoggerParameters` type
@@ -99,6 +229,9 @@ namespace hyperion {
 	concept LoggerParametersType = requires() {
 		T::policy;
 		T::minimum_level;
+		T::buffering;
+		T::formatting;
+		T::time_stamp_precision;
 	};
 
 	/// @brief Alias for the default logging configuration parameters
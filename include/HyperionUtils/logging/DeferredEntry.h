@@ -0,0 +1,279 @@
+/// @brief Log entry type used by `Logger`s configured with `LogFormatting::Deferred`
+#pragma once
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "../BasicTypes.h"
+#include "../Macros.h"
+#include "BinaryLog.h"
+#include "Config.h"
+#include "fmtIncludes.h"
+
+namespace hyperion {
+
+	/// @brief Whether log arguments of type `T` may be captured by value and formatted later, on
+	/// another thread.
+	///
+	/// Being trivially copyable doesn't mean a type owns what it formats: a span, a view, or a
+	/// struct holding a `const char*` is trivially copyable, but what it refers to may no longer
+	/// exist by the time the entry is formatted. So deferral is opt-in: only arithmetic types
+	/// and enums are deferrable by default. Specialize this as `std::true_type` for a trivially
+	/// copyable type that owns everything it formats to have it deferred too
+	///
+	/// @tparam T - The type of the argument, without cv or reference qualifiers
+	template<typename T>
+	struct is_deferrable_argument
+		: std::bool_constant<std::is_arithmetic_v<T> || std::is_enum_v<T>> { };
+
+	/// @brief Value of `is_deferrable_argument<T>`
+	template<typename T>
+	inline constexpr bool is_deferrable_argument_v = is_deferrable_argument<T>::value;
+
+	/// @brief Requirements for a log argument to be captured by value and formatted later, on
+	/// another thread: it must be opted in by `is_deferrable_argument` and be trivially
+	/// copyable. Pointers and ranges borrowing their elements (spans and views) are never
+	/// deferred, even if opted in, because what they refer to may no longer exist by the time the
+	/// entry is formatted
+	template<typename T>
+	concept DeferrableArgument = is_deferrable_argument_v<std::remove_cvref_t<T>>
+								 && std::is_trivially_copyable_v<std::remove_cvref_t<T>>
+								 && !std::is_pointer_v<std::decay_t<T>>
+								 && !std::is_array_v<std::remove_cvref_t<T>>
+								 && !std::ranges::borrowed_range<std::remove_cvref_t<T>>
+								 && !std::ranges::view<std::remove_cvref_t<T>>;
+
+	/// @brief Requirements for a format string to be captured by reference and formatted later,
+	/// on another thread: it must be checked at compile time (ie: created with `FMT_STRING`).
+	/// Those are always string literals, so they outlive any entry referring to them. Any other
+	/// format string, even a character array, may be built at runtime in storage that's reused
+	/// before the entry is formatted
+	template<typename S>
+	concept CompileTimeFormatString =
+#if FMT_VERSION >= 80000
+		fmt::detail::is_compile_string<S>::value;
+#else
+		fmt::is_compile_string<S>::value;
+#endif
+
+	/// @brief Trivially copyable aggregate holding a pack of deferred log arguments
+	///
+	/// @tparam Args - The types of the arguments
+	template<typename... Args>
+	struct DeferredArguments { };
+
+	template<typename T, typename... Rest>
+	struct DeferredArguments<T, Rest...> {
+		template<typename U, typename... Us>
+		explicit constexpr DeferredArguments(U&& _first, Us&&... _rest) noexcept
+			: first(std::forward<U>(_first)), rest(std::forward<Us>(_rest)...) {
+		}
+
+		T first;
+		DeferredArguments<Rest...> rest;
+	};
+
+	IGNORE_PADDING_START
+	/// @brief A log entry that hasn't necessarily been formatted yet.
+	///
+	/// Holds the entry's level, the id of the thread that logged it, a raw `steady_clock`
+	/// timestamp, and either its format string and a copy of its arguments, to be formatted later
+	/// by `format_to`, or its already formatted text
+	class DeferredEntry {
+	  public:
+		using clock = std::chrono::steady_clock;
+
+		/// @brief The maximum total size of the arguments of a deferred entry
+		static constexpr usize ARGUMENTS_CAPACITY = 64_usize;
+
+		/// @brief Whether an entry with the given argument types can have its formatting deferred
+		template<typename... Args>
+		static constexpr bool is_deferrable
+			= (DeferrableArgument<Args> && ...)
+			  && sizeof(DeferredArguments<std::remove_cvref_t<Args>...>) <= ARGUMENTS_CAPACITY
+			  && alignof(DeferredArguments<std::remove_cvref_t<Args>...>)
+					 <= alignof(std::max_align_t);
+
+		DeferredEntry() noexcept = default;
+
+		/// @brief Constructs a `DeferredEntry` that will be formatted later
+		///
+		/// @param level - The level of the entry
+		/// @param thread_id - The id of the thread logging the entry
+		/// @param timestamp - When the entry was logged
+		/// @param format_string - The format string. Must outlive the entry
+		/// @param args - The arguments to format the entry with
+		template<typename... Args>
+		requires(is_deferrable<Args...>) DeferredEntry(LogLevel level,
+													   usize thread_id,
+													   clock::time_point timestamp,
+													   std::string_view format_string,
+													   Args&&... args) noexcept
+			: m_level(level), m_thread_id(thread_id), m_timestamp(timestamp),
+			  m_format_string(format_string),
+			  m_format(&format_arguments<std::remove_cvref_t<Args>...>),
+			  m_encode(&encode_arguments<std::remove_cvref_t<Args>...>) {
+			const auto arguments
+				= DeferredArguments<std::remove_cvref_t<Args>...>(std::forward<Args>(args)...);
+			std::memcpy(m_arguments.data(), &arguments, sizeof(arguments));
+		}
+
+		/// @brief Constructs a `DeferredEntry` from already formatted text
+		///
+		/// @param level - The level of the entry
+		/// @param thread_id - The id of the thread logging the entry
+		/// @param timestamp - When the entry was logged
+		/// @param formatted - The formatted text of the entry
+		DeferredEntry(LogLevel level,
+					  usize thread_id,
+					  clock::time_point timestamp,
+					  std::string&& formatted) noexcept
+			: m_level(level), m_thread_id(thread_id), m_timestamp(timestamp),
+			  m_formatted(std::move(formatted)) {
+		}
+		DeferredEntry(const DeferredEntry& entry) noexcept = default;
+		DeferredEntry(DeferredEntry&& entry) noexcept = default;
+		~DeferredEntry() noexcept = default;
+
+		/// @brief Returns the `LogLevel` of this entry
+		///
+		/// @return The `LogLevel` of this entry
+		[[nodiscard]] inline auto level() const noexcept -> LogLevel {
+			return m_level;
+		}
+
+		/// @brief Returns the id of the thread that logged this entry
+		///
+		/// @return The thread id
+		[[nodiscard]] inline auto thread_id() const noexcept -> usize {
+			return m_thread_id;
+		}
+
+		/// @brief Returns when this entry was logged
+		///
+		/// @return The timestamp of this entry
+		[[nodiscard]] inline auto timestamp() const noexcept -> clock::time_point {
+			return m_timestamp;
+		}
+
+		/// @brief Appends the formatted text of this entry to `buffer`
+		///
+		/// @param buffer - The buffer to format into
+		inline auto format_to(fmt::memory_buffer& buffer) const noexcept -> void {
+			if(m_format != nullptr) {
+				m_format(buffer, m_format_string, m_arguments.data());
+			}
+			else {
+				buffer.append(m_formatted.data(), m_formatted.data() + m_formatted.size());
+			}
+		}
+
+		/// @brief Returns whether this entry still has to be formatted, ie: it holds a format
+		/// string and arguments instead of already formatted text
+		///
+		/// @return Whether this entry's formatting was deferred
+		[[nodiscard]] inline auto is_deferred() const noexcept -> bool {
+			return m_format != nullptr;
+		}
+
+		/// @brief Returns the format string of this entry. Only meaningful if `is_deferred`
+		///
+		/// @return The format string
+		[[nodiscard]] inline auto format_string() const noexcept -> std::string_view {
+			return m_format_string;
+		}
+
+		/// @brief Returns the already formatted text of this entry. Only meaningful if
+		/// `is_deferred` is false
+		///
+		/// @return The formatted text
+		[[nodiscard]] inline auto formatted() const noexcept -> std::string_view {
+			return m_formatted;
+		}
+
+		/// @brief Appends the arguments of this entry to `buffer` in the binary log format: a
+		/// u8 argument count, followed by each argument as written by
+		/// `binary_log::write_argument`. Only meaningful if `is_deferred`
+		///
+		/// @param buffer - The buffer to encode into
+		inline auto encode_arguments_to(fmt::memory_buffer& buffer) const noexcept -> void {
+			if(m_encode != nullptr) {
+				m_encode(buffer, m_arguments.data());
+			}
+		}
+
+		auto operator=(const DeferredEntry& entry) noexcept -> DeferredEntry& = default;
+		auto operator=(DeferredEntry&& entry) noexcept -> DeferredEntry& = default;
+
+	  private:
+		using format_function = void (*)(fmt::memory_buffer&, std::string_view, const std::byte*);
+		using encode_function = void (*)(fmt::memory_buffer&, const std::byte*);
+
+		LogLevel m_level = LogLevel::MESSAGE;
+		usize m_thread_id = 0_usize;
+		clock::time_point m_timestamp = clock::time_point();
+		std::string_view m_format_string = std::string_view();
+		format_function m_format = nullptr;
+		encode_function m_encode = nullptr;
+		alignas(std::max_align_t) std::array<std::byte, ARGUMENTS_CAPACITY> m_arguments = {};
+		std::string m_formatted = std::string();
+
+		template<typename... Args>
+		static inline auto format_arguments(fmt::memory_buffer& buffer,
+											std::string_view format_string,
+											const std::byte* arguments) noexcept -> void {
+			using arguments_type = DeferredArguments<Args...>;
+			auto bytes = std::array<std::byte, sizeof(arguments_type)>();
+			std::memcpy(bytes.data(), arguments, sizeof(arguments_type));
+			auto unpacked = std::bit_cast<arguments_type>(bytes);
+			format_unpacked(buffer, format_string, unpacked);
+		}
+
+		template<typename... Args>
+		static inline auto
+		encode_arguments(fmt::memory_buffer& buffer, const std::byte* arguments) noexcept -> void {
+			using arguments_type = DeferredArguments<Args...>;
+			auto bytes = std::array<std::byte, sizeof(arguments_type)>();
+			std::memcpy(bytes.data(), arguments, sizeof(arguments_type));
+			const auto unpacked = std::bit_cast<arguments_type>(bytes);
+			binary_log::write(buffer, static_cast<u8>(sizeof...(Args)));
+			encode_unpacked(buffer, unpacked);
+		}
+
+		template<typename... Args>
+		static inline auto encode_unpacked(fmt::memory_buffer& buffer,
+										   const DeferredArguments<Args...>& arguments) noexcept
+			-> void {
+			if constexpr(sizeof...(Args) != 0) {
+				binary_log::write_argument(buffer, arguments.first);
+				encode_unpacked(buffer, arguments.rest);
+			}
+		}
+
+		template<typename... Args, typename... Unpacked>
+		static inline auto format_unpacked(fmt::memory_buffer& buffer,
+										   std::string_view format_string,
+										   DeferredArguments<Args...>& arguments,
+										   Unpacked&... unpacked) noexcept -> void {
+			if constexpr(sizeof...(Args) == 0) {
+				fmt::vformat_to(std::back_inserter(buffer),
+								fmt::string_view(format_string.data(), format_string.size()),
+								fmt::make_format_args(unpacked...));
+			}
+			else {
+				format_unpacked(buffer, format_string, arguments.rest, unpacked..., arguments.first);
+			}
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
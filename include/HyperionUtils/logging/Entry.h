@@ -1,10 +1,16 @@
 #pragma once
 
-#include <variant>
+#include <algorithm>
+#include <array>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
 
+#include "../BasicTypes.h"
 #include "../Concepts.h"
 #include "../Macros.h"
 #include "Config.h"
+#include "Field.h"
 #include "fmtIncludes.h"
 
 namespace hyperion {
@@ -253,7 +259,7 @@ namespace hyperion {
 		///
 		/// @return The `LogLevel` of this entry
 		[[nodiscard]] inline constexpr auto log_level() const noexcept -> LogLevel { // NOLINT
-			return LogLevel::INFO;
+			return LogLevel::WARN;
 		}
 
 		/// @brief Returns the text style of this entry
@@ -303,7 +309,7 @@ namespace hyperion {
 		///
 		/// @return The `LogLevel` of this entry
 		[[nodiscard]] inline constexpr auto log_level() const noexcept -> LogLevel { // NOLINT
-			return LogLevel::INFO;
+			return LogLevel::ERROR;
 		}
 
 		/// @brief Returns the text style of this entry
@@ -330,67 +336,345 @@ namespace hyperion {
 		std::string m_entry;
 	};
 
-	/// @brief Compile-time polymorphic type encapsulating the various possible log entry types.
-	/// This can be one of `MessageEntry`, `TraceEntry`, `InfoEntry`, `WarnEntry`, `ErrorEntry`
-	/// at any one point in time, and will dispatch to the correct type when queried.
+	IGNORE_PADDING_START
+	/// @brief Type-erased log entry holding the text of any of `MessageEntry`, `TraceEntry`,
+	/// `InfoEntry`, `WarnEntry`, or `ErrorEntry`.
+	///
+	/// An `Entry` is a flat level tag plus its text. Text of up to `INLINE_CAPACITY` characters is
+	/// stored inline, so creating, queueing, and sinking a typical entry doesn't allocate; longer
+	/// text spills to a pool shared by all entries, since entries are usually created on one
+	/// thread and destroyed on another. Moving an `Entry` only copies its inline text and steals
+	/// any spilled text, so entries are cheap to relocate between queue slots.
 	///
-	/// TODO: replace std::variant with our own custom variant-like type that can't be valueless
+	/// Entries created by a `Logger` (see `logged`) also record where their message starts and
+	/// ends within their text, the id of the thread that logged them, and any structured `Field`s
+	/// attached to them. Fields are rendered onto the end of the text as `key=value`, and also
+	/// kept typed, after the text, for sinks that write them out in a structured format
 	class Entry {
 	  public:
-		using variant_type
-			= std::variant<MessageEntry, TraceEntry, InfoEntry, WarnEntry, ErrorEntry>;
+		/// @brief The size of an `Entry`
+		static constexpr usize SIZE = 256_usize;
+		/// @brief The maximum length of text and fields stored inline in the `Entry`
+		static constexpr usize INLINE_CAPACITY = SIZE - sizeof(char*) - sizeof(usize) * 2_usize
+												 - sizeof(u32) * 2_usize - sizeof(u16)
+												 - sizeof(u8) - sizeof(LogLevel);
 
-		HYPERION_CONSTEXPR_STRINGS Entry() noexcept : m_inner(MessageEntry("DefaultMessage\n")) {
+		Entry() noexcept : Entry(LogLevel::MESSAGE, "DefaultMessage\n") {
 		}
-		explicit HYPERION_CONSTEXPR_STRINGS Entry(const EntryType auto& entry) noexcept
-			: m_inner(entry) {
+		explicit Entry(const EntryType auto& entry) noexcept : Entry(entry.level(), "{}", entry.entry()) {
 		}
-		explicit HYPERION_CONSTEXPR_STRINGS
-		Entry(EntryType auto&& entry) noexcept // NOLINT(bugprone-forwarding-reference-overload)
-											   // the forwarding reference here is fine because it's
-											   // constrained by the concept
-			: m_inner(std::forward<decltype(entry)>(entry)) {
+		/// @brief Constructs an `Entry` of the given level by formatting `format_string` with
+		/// `args` directly into the entry
+		///
+		/// @param level - The `LogLevel` of the entry
+		/// @param format_string - The format string for the entry's text
+		/// @param args - The arguments to format the entry's text with
+		template<typename S, typename... Args, typename Char = fmt::char_t<S>>
+		Entry(LogLevel level, const S& format_string, Args&&... args) noexcept
+			: m_level(level) {
+			append(format_string, std::forward<Args>(args)...);
 		}
 		template<EntryType T, typename... Args>
-		explicit HYPERION_CONSTEXPR_STRINGS
-		Entry(std::in_place_type_t<T> tag, Args&&... args) noexcept
-			: m_inner(tag, std::forward<Args>(args)...) {
+		explicit Entry([[maybe_unused]] std::in_place_type_t<T> tag, Args&&... args) noexcept
+			: Entry(T(std::forward<Args>(args)...)) {
+		}
+		Entry(const Entry& entry) noexcept
+			: m_size(entry.m_size), m_thread_id(entry.m_thread_id),
+			  m_text_size(entry.m_text_size), m_message_size(entry.m_message_size),
+			  m_message_offset(entry.m_message_offset), m_time_stamp_size(entry.m_time_stamp_size),
+			  m_level(entry.m_level) {
+			copy_text_from(entry);
+		}
+		Entry(Entry&& entry) noexcept
+			: m_spilled(std::exchange(entry.m_spilled, nullptr)), m_size(entry.m_size),
+			  m_thread_id(entry.m_thread_id), m_text_size(entry.m_text_size),
+			  m_message_size(entry.m_message_size), m_message_offset(entry.m_message_offset),
+			  m_time_stamp_size(entry.m_time_stamp_size), m_level(entry.m_level) {
+			if(m_spilled == nullptr) {
+				std::copy_n(entry.m_inline.data(), m_size, m_inline.data());
+			}
+			entry.clear_metadata();
+		}
+		~Entry() noexcept {
+			deallocate();
+		}
+
+		/// @brief Starts the entry for a call to `Logger::log`: the prefix every logged entry
+		/// starts with (its time stamp, `thread_id`, and level), ready for its message to be
+		/// appended with `append`. The entry must be finished with `end_message`
+		///
+		/// @param level - The `LogLevel` of the entry
+		/// @param thread_id - The id of the thread logging the entry
+		/// @param time_stamp - The rendered time stamp of the entry
+		///
+		/// @return The started entry
+		[[nodiscard]] inline static auto
+		logged(LogLevel level, usize thread_id, std::string_view time_stamp) noexcept -> Entry {
+			auto entry = Entry(level,
+							   "{0}  [Thread ID: {1}] [{2}]: ",
+							   time_stamp,
+							   thread_id,
+							   log_level_name(level));
+			entry.m_thread_id = thread_id;
+			entry.m_time_stamp_size = static_cast<u8>(std::min(time_stamp.size(), 255_usize));
+			entry.m_message_offset = static_cast<u16>(entry.m_text_size);
+			return entry;
+		}
+
+		/// @brief Ends the message of an entry started with `logged`: renders `fields` onto the
+		/// end of its text, followed by a newline, and stores them typed after the text. No more
+		/// text can be appended afterwards
+		///
+		/// @param fields - The fields to attach to the entry
+		template<typename... T>
+		inline auto end_message(const Field<T>&... fields) noexcept -> void {
+			m_message_size = static_cast<u32>(m_text_size - m_message_offset);
+			(append(" {}={}", fields.key, fields.value), ...);
+			append("\n");
+
+			if constexpr(sizeof...(T) != 0) {
+				auto encoded = fmt::memory_buffer();
+				(fields::encode(encoded, fields), ...);
+				append_bytes(std::string_view(encoded.data(), encoded.size()));
+			}
 		}
-		HYPERION_CONSTEXPR_STRINGS Entry(const Entry& entry) noexcept = default;
-		HYPERION_CONSTEXPR_STRINGS Entry(Entry&& entry) noexcept = default;
-		HYPERION_CONSTEXPR_STRINGS ~Entry() noexcept = default;
 
 		/// @brief Returns the `LogLevel` associated with this entry
 		///
 		/// @return The `LogLevel` of this entry
 		[[nodiscard]] inline constexpr auto level() const noexcept -> LogLevel {
-			return std::visit([](const auto& entry) { return entry.level(); }, m_inner);
+			return m_level;
 		}
 
 		/// @brief Returns the text style of this entry
 		///
 		/// @return The `fmt::text_style` of this entry
 		[[nodiscard]] inline constexpr auto style() const noexcept -> fmt::text_style {
-			return std::visit([](const auto& entry) { return entry.style(); }, m_inner);
+			switch(m_level) {
+				case LogLevel::TRACE: return fmt::fg(fmt::color::steel_blue);
+				case LogLevel::INFO: return fmt::fg(fmt::color::light_green) | fmt::emphasis::italic;
+				case LogLevel::WARN: return fmt::fg(fmt::color::orange) | fmt::emphasis::bold;
+				case LogLevel::ERROR: return fmt::fg(fmt::color::red) | fmt::emphasis::bold;
+				default: return fmt::fg(fmt::color::white);
+			}
 		}
 
 		/// @brief Returns the text entry for this
 		///
 		/// @return The text entry
 		[[nodiscard]] inline constexpr auto entry() const noexcept -> std::string_view {
-			return std::visit([](const auto& entry) { return entry.entry(); }, m_inner);
+			return {data(), m_text_size};
+		}
+
+		/// @brief Returns the message of this entry: its text without the prefix, fields, or
+		/// newline added by a `Logger`. For entries not created by a `Logger`, this is the whole
+		/// text
+		///
+		/// @return The message
+		[[nodiscard]] inline constexpr auto message() const noexcept -> std::string_view {
+			if(!is_logged()) {
+				return entry();
+			}
+			return {data() + m_message_offset, m_message_size}; // NOLINT
+		}
+
+		/// @brief Returns the time stamp of this entry, as rendered in its text. Empty for
+		/// entries not created by a `Logger`
+		///
+		/// @return The time stamp
+		[[nodiscard]] inline constexpr auto time_stamp() const noexcept -> std::string_view {
+			return {data(), m_time_stamp_size};
+		}
+
+		/// @brief Returns the id of the thread that logged this entry. 0 for entries not created
+		/// by a `Logger`
+		///
+		/// @return The thread id
+		[[nodiscard]] inline constexpr auto thread_id() const noexcept -> usize {
+			return m_thread_id;
+		}
+
+		/// @brief Returns whether this entry was created by a `Logger`, ie: has a time stamp,
+		/// thread id, and separately delimited message
+		///
+		/// @return Whether this entry was logged
+		[[nodiscard]] inline constexpr auto is_logged() const noexcept -> bool {
+			return m_time_stamp_size != 0_u8;
+		}
+
+		/// @brief Returns whether this entry has any `Field`s attached
+		///
+		/// @return Whether this entry has fields
+		[[nodiscard]] inline constexpr auto has_fields() const noexcept -> bool {
+			return m_size != m_text_size;
+		}
+
+		/// @brief Calls `function` with the key and value of each of this entry's `Field`s, in
+		/// the order they were attached
+		///
+		/// @param function - The function to call for each field, with the signature
+		/// `(std::string_view key, const FieldValue& value)`
+		template<typename Function>
+		inline auto for_each_field(Function&& function) const noexcept -> void {
+			fields::decode(std::string_view(data() + m_text_size, m_size - m_text_size), // NOLINT
+						   std::forward<Function>(function));
+		}
+
+		/// @brief Returns whether this entry's text is stored inline
+		///
+		/// @return Whether the text is inline
+		[[nodiscard]] inline constexpr auto is_inline() const noexcept -> bool {
+			return m_spilled == nullptr;
 		}
 
 		[[nodiscard]] inline constexpr auto valid() const noexcept -> bool {
-			return !m_inner.valueless_by_exception();
+			return true;
 		}
 
-		HYPERION_CONSTEXPR_STRINGS auto operator=(const Entry& entry) noexcept -> Entry& = default;
-		HYPERION_CONSTEXPR_STRINGS auto operator=(Entry&& entry) noexcept -> Entry& = default;
+		/// @brief Formats `format_string` with `args` onto the end of this entry's text
+		///
+		/// @param format_string - The format string for the appended text
+		/// @param args - The arguments to format the appended text with
+		template<typename S, typename... Args, typename Char = fmt::char_t<S>>
+		inline auto append(const S& format_string, Args&&... args) noexcept -> void {
+			if(m_spilled == nullptr) {
+				const auto result = fmt::format_to_n(m_inline.data() + m_size, // NOLINT
+													 INLINE_CAPACITY - m_size,
+													 format_string,
+													 args...);
+				const auto appended = static_cast<usize>(result.size);
+				if(m_size + appended <= INLINE_CAPACITY) {
+					m_size += appended;
+					m_text_size = static_cast<u32>(m_size);
+					return;
+				}
+
+				auto* spilled = allocate(m_size + appended);
+				std::copy_n(m_inline.data(), m_size, spilled);
+				fmt::format_to(spilled + m_size, format_string, args...); // NOLINT
+				m_spilled = spilled;
+				m_size += appended;
+			}
+			else {
+				const auto appended = fmt::formatted_size(format_string, args...);
+				auto* spilled = allocate(m_size + appended);
+				std::copy_n(m_spilled, m_size, spilled);
+				fmt::format_to(spilled + m_size, format_string, args...); // NOLINT
+				deallocate();
+				m_spilled = spilled;
+				m_size += appended;
+			}
+			m_text_size = static_cast<u32>(m_size);
+		}
+
+		auto operator=(const Entry& entry) noexcept -> Entry& {
+			if(this == &entry) {
+				return *this;
+			}
+
+			deallocate();
+			copy_metadata_from(entry);
+			copy_text_from(entry);
+			return *this;
+		}
+		auto operator=(Entry&& entry) noexcept -> Entry& {
+			if(this == &entry) {
+				return *this;
+			}
+
+			deallocate();
+			copy_metadata_from(entry);
+			m_spilled = std::exchange(entry.m_spilled, nullptr);
+			if(m_spilled == nullptr) {
+				std::copy_n(entry.m_inline.data(), m_size, m_inline.data());
+			}
+			entry.clear_metadata();
+			return *this;
+		}
 
 	  private:
-		variant_type m_inner = variant_type(MessageEntry("DefaultMessage\n"));
+		char* m_spilled = nullptr;
+		// the size of the text and encoded fields
+		usize m_size = 0_usize;
+		usize m_thread_id = 0_usize;
+		u32 m_text_size = 0_u32;
+		u32 m_message_size = 0_u32;
+		std::array<char, INLINE_CAPACITY> m_inline = {};
+		u16 m_message_offset = 0_u16;
+		u8 m_time_stamp_size = 0_u8;
+		LogLevel m_level = LogLevel::MESSAGE;
+
+		[[nodiscard]] inline constexpr auto data() const noexcept -> const char* {
+			return m_spilled != nullptr ? m_spilled : m_inline.data();
+		}
+
+		/// @brief Appends `bytes` to the end of the entry, after its text
+		inline auto append_bytes(std::string_view bytes) noexcept -> void {
+			if(m_spilled == nullptr && m_size + bytes.size() <= INLINE_CAPACITY) {
+				std::copy_n(bytes.data(), bytes.size(), m_inline.data() + m_size); // NOLINT
+				m_size += bytes.size();
+				return;
+			}
+
+			auto* spilled = allocate(m_size + bytes.size());
+			std::copy_n(data(), m_size, spilled);
+			std::copy_n(bytes.data(), bytes.size(), spilled + m_size); // NOLINT
+			deallocate();
+			m_spilled = spilled;
+			m_size += bytes.size();
+		}
+
+		inline auto copy_metadata_from(const Entry& entry) noexcept -> void {
+			m_size = entry.m_size;
+			m_thread_id = entry.m_thread_id;
+			m_text_size = entry.m_text_size;
+			m_message_size = entry.m_message_size;
+			m_message_offset = entry.m_message_offset;
+			m_time_stamp_size = entry.m_time_stamp_size;
+			m_level = entry.m_level;
+		}
+
+		/// @brief Empties a moved-from entry, so its sizes and offsets don't describe text it no
+		/// longer holds
+		inline auto clear_metadata() noexcept -> void {
+			m_size = 0_usize;
+			m_thread_id = 0_usize;
+			m_text_size = 0_u32;
+			m_message_size = 0_u32;
+			m_message_offset = 0_u16;
+			m_time_stamp_size = 0_u8;
+		}
+
+		/// @brief Returns the pool text too long to be stored inline is allocated from
+		[[nodiscard]] inline static auto spill_resource() noexcept -> std::pmr::memory_resource* {
+			HYPERION_NO_DESTROY static std::pmr::synchronized_pool_resource RESOURCE{};
+			return &RESOURCE;
+		}
+
+		[[nodiscard]] inline static auto allocate(usize size) noexcept -> char* {
+			return static_cast<char*>(spill_resource()->allocate(size, alignof(char)));
+		}
+
+		inline auto deallocate() noexcept -> void {
+			if(m_spilled != nullptr) {
+				spill_resource()->deallocate(m_spilled, m_size, alignof(char));
+				m_spilled = nullptr;
+			}
+		}
+
+		inline auto copy_text_from(const Entry& entry) noexcept -> void {
+			if(entry.m_spilled != nullptr) {
+				m_spilled = allocate(m_size);
+				std::copy_n(entry.m_spilled, m_size, m_spilled);
+			}
+			else {
+				std::copy_n(entry.m_inline.data(), m_size, m_inline.data());
+			}
+		}
 	};
+	IGNORE_PADDING_STOP
+
+	static_assert(sizeof(Entry) == Entry::SIZE, "Entry has unexpected padding");
 
 	using concepts::ConstructibleFrom;
 
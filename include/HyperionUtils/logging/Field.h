@@ -0,0 +1,154 @@
+/// @brief Structured key-value fields attached to log entries
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "../BasicTypes.h"
+#include "BinaryLog.h"
+#include "fmtIncludes.h"
+
+namespace hyperion {
+
+	/// @brief A key-value pair to attach to a log entry as a typed field, instead of formatting
+	/// it into the entry's message.
+	///
+	/// A `Field` only refers to its key and value, so it must be logged in the same expression it
+	/// was created in. Create one with `field`
+	///
+	/// @tparam T - The type of the value
+	template<typename T>
+	struct Field {
+		/// @brief The key of the field
+		std::string_view key;
+		/// @brief The value of the field
+		const T& value;
+	};
+
+	/// @brief Creates a `Field` attaching `value` to a log entry under `key`.
+	/// Fields are passed to `Logger::log` after the arguments for the format string, ie:
+	///
+	/// `logger.info(None(), "request finished", field("status", 200), field("path", path));`
+	///
+	/// @param key - The key of the field
+	/// @param value - The value of the field
+	///
+	/// @return The `Field`
+	template<typename T>
+	[[nodiscard]] inline constexpr auto field(std::string_view key, const T& value) noexcept
+		-> Field<T> {
+		return {key, value};
+	}
+
+	/// @brief Whether `T` is a `Field`
+	template<typename T>
+	inline constexpr bool is_field_v = false;
+
+	template<typename T>
+	inline constexpr bool is_field_v<Field<T>> = true;
+
+	/// @brief The number of `Field`s in `Args`
+	template<typename... Args>
+	inline constexpr usize num_fields_v
+		= (0_usize + ... + (is_field_v<std::remove_cvref_t<Args>> ? 1_usize : 0_usize));
+
+	/// @brief Whether every `Field` in `Args` comes after all of the arguments that aren't
+	/// `Field`s
+	template<typename... Args>
+	inline constexpr bool fields_are_trailing_v = []() {
+		constexpr auto num_args = sizeof...(Args);
+		constexpr bool is_field[] = {is_field_v<std::remove_cvref_t<Args>>..., false}; // NOLINT
+		auto seen_field = false;
+		for(auto i = 0_usize; i < num_args; ++i) {
+			if(seen_field && !is_field[i]) { // NOLINT
+				return false;
+			}
+			seen_field = seen_field || is_field[i]; // NOLINT
+		}
+		return true;
+	}();
+
+	/// @brief The value of a field, as decoded from an entry. Integers are widened to 64 bits,
+	/// floating point values to `double`, and any other type was formatted with "{}" when the
+	/// field was attached
+	using FieldValue = std::variant<bool, char, i64, u64, double, std::string_view>;
+
+	namespace fields {
+
+		/// @brief Appends `field` to `buffer`: its key, then its value encoded the same way as
+		/// the arguments of a binary log entry
+		///
+		/// @param buffer - The buffer to append to
+		/// @param field - The field to append
+		template<typename T>
+		inline auto encode(fmt::memory_buffer& buffer, const Field<T>& field) noexcept -> void {
+			binary_log::write_string(buffer, field.key);
+			binary_log::write_argument(buffer, field.value);
+		}
+
+		/// @brief Decodes the fields in `encoded`, calling `function` with the key and value of
+		/// each, in the order they were encoded. Stops at the first malformed field
+		///
+		/// @param encoded - The fields, as encoded by `encode`
+		/// @param function - The function to call for each field, with the signature
+		/// `(std::string_view key, const FieldValue& value)`
+		template<typename Function>
+		inline auto decode(std::string_view encoded, Function&& function) noexcept -> void {
+			auto reader = binary_log::Reader(encoded);
+			while(!reader.at_end()) {
+				auto key = std::string_view();
+				auto type = binary_log::ArgumentType::String;
+				if(!reader.read_string(key) || !reader.read(type)) {
+					return;
+				}
+
+				const auto read = [&]<typename T>(T value) {
+					const auto valid = reader.read(value);
+					if(valid) {
+						function(key, FieldValue(value));
+					}
+					return valid;
+				};
+
+				auto valid = false;
+				switch(type) {
+					case binary_log::ArgumentType::Bool: {
+						auto value = u8(0);
+						valid = reader.read(value);
+						if(valid) {
+							function(key, FieldValue(value != 0));
+						}
+						break;
+					}
+					case binary_log::ArgumentType::Char: valid = read(char(0)); break;
+					case binary_log::ArgumentType::Signed: valid = read(i64(0)); break;
+					case binary_log::ArgumentType::Unsigned: valid = read(u64(0)); break;
+					case binary_log::ArgumentType::Float: {
+						auto value = 0.0F;
+						valid = reader.read(value);
+						if(valid) {
+							function(key, FieldValue(static_cast<double>(value)));
+						}
+						break;
+					}
+					case binary_log::ArgumentType::Double: valid = read(0.0); break;
+					case binary_log::ArgumentType::String: {
+						auto value = std::string_view();
+						valid = reader.read_string(value);
+						if(valid) {
+							function(key, FieldValue(value));
+						}
+						break;
+					}
+					default: break;
+				}
+
+				if(!valid) {
+					return;
+				}
+			}
+		}
+	} // namespace fields
+} // namespace hyperion
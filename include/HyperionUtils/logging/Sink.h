@@ -1,13 +1,40 @@
 #pragma once
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <deque>
 #include <filesystem>
+#include <iterator>
+#include <memory>
+#include <system_error>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
 #include <vector>
 
+#if defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <unistd.h>
+
+	/// Defined when `MappedFileSink` is available
+	#define HYPERION_HAS_MAPPED_FILE_SINK // NOLINT
+	/// Defined when `AsyncFileSink` is available
+	#define HYPERION_HAS_ASYNC_FILE_SINK // NOLINT
+#endif
+
 #include "../Monads.h"
+#include "../Span.h"
+#include "AsyncFileWriter.h"
+#include "BinaryLog.h"
+#include "DeferredEntry.h"
 #include "Entry.h"
 #include "SinkBase.h"
+#include "TimeStamp.h"
 #include "fmtIncludes.h"
 
 namespace hyperion {
@@ -80,8 +107,42 @@ namespace hyperion {
 	/// Alias for the file type used internally be `FileSink`s
 	using OutputFilePointer = std::unique_ptr<fmt::ostream>;
 
+	/// @brief When a `FileSink` writes the entries it has buffered to its file
+	struct FileFlushThreshold {
+		/// @brief Buffered entries are written once they total at least this many bytes
+		usize bytes = 64_usize * 1024_usize; // NOLINT
+		/// @brief Buffered entries are written once the oldest has been buffered this long
+		std::chrono::milliseconds interval = std::chrono::milliseconds(100); // NOLINT
+	};
+
+	/// @brief When a `FileSink` created with `FileSink::create_rotating` moves on to a new file,
+	/// and how many of its files it keeps
+	struct FileRotation {
+		/// @brief The file is rotated before it would grow past this many bytes. 0 disables
+		/// rotating by size
+		usize max_bytes = 0_usize;
+		/// @brief The file is rotated once it has been open this long. 0 disables rotating by
+		/// time
+		std::chrono::seconds interval = std::chrono::seconds(0);
+		/// @brief The maximum number of files to keep, including the current one. Older files
+		/// are deleted. 0 keeps every file
+		usize max_files = 0_usize;
+	};
+
 	/// @brief Logging Sink type to sink to a file
 	///
+	/// Entries are coalesced into a single buffer and written to the file together, once the
+	/// buffer reaches the size, or the oldest buffered entry the age, given by the sink's
+	/// `FileFlushThreshold`, or when the logger sinking to it runs out of entries to sink.
+	///
+	/// A `FileSink` created with `create_rotating` also rotates to a new file as configured by its
+	/// `FileRotation`. The file is rotated before buffering an entry that would take it past
+	/// `FileRotation::max_bytes`, or that arrives after `FileRotation::interval` has elapsed, and
+	/// when the sink is flushed after the interval has elapsed, which a `Logger` does at least
+	/// once per second while idle. Rotation happens on the thread sinking entries: the new file
+	/// is opened before the old one is closed, and the sink keeps writing to the old file if
+	/// opening the new one fails
+	///
 	/// @tparam Style - Whether the text should be styled or not
 	template<SinkTextStyle Style = SinkTextStyle::NotStyled>
 	class FileSink final : public SinkBase<FileSink<Style>> {
@@ -90,39 +151,104 @@ namespace hyperion {
 		static constexpr auto DEFAULT_FILE_SUBDIRECTORY = "Hyperion";
 
 		FileSink() noexcept = delete;
-		explicit FileSink(OutputFilePointer&& file) noexcept // NOLINT
-			: m_file(std::forward<OutputFilePointer>(file)) {
+		explicit FileSink(OutputFilePointer&& file, // NOLINT
+						  FileFlushThreshold threshold = FileFlushThreshold()) noexcept
+			: m_file(std::forward<OutputFilePointer>(file)), m_threshold(threshold) {
 		}
 		FileSink(const FileSink& sink) noexcept = delete;
 		FileSink(FileSink&& sink) noexcept = default;
 		~FileSink() noexcept {
-			m_file->close();
+			if(m_file != nullptr) {
+				flush_entries();
+				m_file->close();
+			}
 		}
 
 		/// @brief Sinks the given entry, writing it to the file associated with this
 		///
 		/// @param entry - The entry to sink
 		inline auto sink_entry(const Entry& entry) noexcept -> void {
-			if constexpr(Style == SinkTextStyle::Styled) {
-				m_file->print(entry.style(), entry.entry());
-			}
-			else {
-				m_file->print(entry.entry());
-			}
+			buffer_entry(entry);
+			flush_if_needed();
 		}
 
 		/// @brief Sinks the given entry, writing it to the file associated with this
 		///
 		/// @param entry - The entry to sink
 		inline auto sink_entry(Entry&& entry) noexcept -> void {
-			if constexpr(Style == SinkTextStyle::Styled) {
-				m_file->print(entry.style(), entry.entry());
+			buffer_entry(entry);
+			flush_if_needed();
+		}
+
+		/// @brief Sinks the given entries, writing them to the file associated with this
+		///
+		/// @param entries - The entries to sink
+		inline auto sink_entries(Span<const Entry> entries) noexcept -> void {
+			for(const auto& entry : entries) {
+				buffer_entry(entry);
 			}
-			else {
-				m_file->print(entry.entry());
+			flush_if_needed();
+		}
+
+		/// @brief Writes any buffered entries to the file associated with this, then rotates to
+		/// a new file if it's due
+		inline auto flush_entries() noexcept -> void {
+			write_buffer();
+			if(should_rotate(0_usize)) {
+				std::ignore = open_next_file().is_ok();
 			}
 		}
 
+		/// @brief Creates a `FileSink` that writes to a series of files inside the subdirectory
+		/// `subdirectory_name` of the system temporary files directory, rotating between them as
+		/// configured by `rotation`
+		///
+		/// # Errors
+		/// Returns an Error if:
+		/// - accessing the system temporary files directory fails
+		/// - creating or accessing the given subdirectory fails
+		/// - creating the first file fails
+		///
+		/// @param rotation - When to rotate files and how many to keep
+		/// @param root_file_name - The relative root file name of the output files. Each file
+		/// will have a timestamp prepended and its index in the series and the ".log" extension
+		/// appended
+		/// @param subdirectory_name - The relative subdirectory to store the files in
+		/// @param threshold - When to write buffered entries to the file
+		///
+		/// @return The `FileSink` on success, `FileCreationError` on error
+		[[nodiscard]] inline static auto
+		create_rotating(FileRotation rotation,
+						const std::string& root_file_name = DEFAULT_FILE_NAME,
+						const std::string& subdirectory_name = DEFAULT_FILE_SUBDIRECTORY,
+						FileFlushThreshold threshold = FileFlushThreshold()) noexcept
+			-> Result<FileSink, FileCreationError> {
+			return get_temp_directory()
+				.and_then([&](std::filesystem::path& temp_directory)
+							  -> Result<std::filesystem::path, FileCreationError> {
+					temp_directory.append(subdirectory_name);
+					return create_subdirectory(temp_directory);
+				})
+				.and_then([&](std::filesystem::path& directory)
+							  -> Result<FileSink, FileCreationError> {
+					auto sink = FileSink(threshold, rotation, directory, root_file_name);
+					auto opened = sink.open_next_file();
+					if(opened.is_err()) {
+						return Err(opened.unwrap_err());
+					}
+					return Ok(std::move(sink));
+				});
+		}
+
+		/// @brief Returns the paths of the files this sink has written to and still keeps,
+		/// oldest first. Empty if this isn't a rotating sink
+		///
+		/// @return The paths of the retained files
+		[[nodiscard]] inline auto
+		files() const noexcept -> const std::deque<std::filesystem::path>& {
+			return m_files;
+		}
+
 		/// @brief Creates an `OutputFilePointer` with the given `file_name` inside the
 		/// subdirectory `subdirectory_name` of the system temporary files directory
 		///
@@ -151,8 +277,9 @@ namespace hyperion {
 				})
 				.and_then([&](std::filesystem::path& temp_directory)
 							  -> Result<OutputFilePointer, FileCreationError> {
-					const auto time_string = create_time_stamp();
-					temp_directory.append(time_string + " "s + root_file_name);
+					const auto time_string
+						= TimeStampCache::instance().time_stamp(std::time(nullptr));
+					temp_directory.append(std::string(time_string.view()) + " "s + root_file_name);
 					temp_directory.replace_extension("log"s);
 					try {
 						return Ok(std::make_unique<fmt::ostream>(
@@ -167,10 +294,160 @@ namespace hyperion {
 		}
 
 		auto operator=(const FileSink& sink) noexcept -> FileSink& = default;
-		auto operator=(FileSink&& sink) noexcept -> FileSink& = default;
+		auto operator=(FileSink&& sink) noexcept -> FileSink& {
+			if(this == &sink) {
+				return *this;
+			}
+
+			// write out what's buffered for the file we're letting go of, like the destructor
+			if(m_file != nullptr) {
+				flush_entries();
+			}
+			m_file = std::move(sink.m_file);
+			m_threshold = sink.m_threshold;
+			m_buffer = std::move(sink.m_buffer);
+			m_first_buffered = sink.m_first_buffered;
+			m_rotation = sink.m_rotation;
+			m_directory = std::move(sink.m_directory);
+			m_root_file_name = std::move(sink.m_root_file_name);
+			m_files = std::move(sink.m_files);
+			m_file_index = sink.m_file_index;
+			m_bytes_written = sink.m_bytes_written;
+			m_opened_at = sink.m_opened_at;
+			return *this;
+		}
 
 	  private:
 		OutputFilePointer m_file;
+		FileFlushThreshold m_threshold = FileFlushThreshold();
+		fmt::memory_buffer m_buffer = fmt::memory_buffer();
+		std::chrono::steady_clock::time_point m_first_buffered
+			= std::chrono::steady_clock::time_point();
+
+		// rotation state, only used by sinks created with `create_rotating`
+		FileRotation m_rotation = FileRotation();
+		std::filesystem::path m_directory = std::filesystem::path();
+		std::string m_root_file_name = std::string();
+		std::deque<std::filesystem::path> m_files = std::deque<std::filesystem::path>();
+		usize m_file_index = 0_usize;
+		usize m_bytes_written = 0_usize;
+		std::chrono::steady_clock::time_point m_opened_at
+			= std::chrono::steady_clock::time_point();
+
+		FileSink(FileFlushThreshold threshold,
+				 FileRotation rotation,
+				 std::filesystem::path directory,
+				 std::string root_file_name) noexcept
+			: m_threshold(threshold), m_rotation(rotation), m_directory(std::move(directory)),
+			  m_root_file_name(std::move(root_file_name)) {
+		}
+
+		/// @brief Returns whether the current file should be rotated before another `bytes` are
+		/// buffered for it. A file nothing has been buffered for is never rotated, so an entry
+		/// larger than `FileRotation::max_bytes` gets a file to itself
+		///
+		/// @param bytes - The number of bytes about to be buffered
+		///
+		/// @return Whether to rotate
+		[[nodiscard]] inline auto should_rotate(usize bytes) const noexcept -> bool {
+			const auto size = m_bytes_written + m_buffer.size();
+			if(m_files.empty() || size == 0_usize) {
+				return false;
+			}
+
+			return (m_rotation.max_bytes != 0_usize && size + bytes > m_rotation.max_bytes)
+				   || (m_rotation.interval != std::chrono::seconds(0)
+					   && std::chrono::steady_clock::now() - m_opened_at >= m_rotation.interval);
+		}
+
+		/// @brief Writes the buffered entries to the current file
+		inline auto write_buffer() noexcept -> void {
+			if(m_buffer.size() == 0_usize) {
+				return;
+			}
+
+			m_file->print("{}", std::string_view(m_buffer.data(), m_buffer.size()));
+			m_file->flush();
+			m_bytes_written += m_buffer.size();
+			m_buffer.clear();
+		}
+
+		/// @brief Opens the next file in the series and switches to it, then deletes the oldest
+		/// files past `FileRotation::max_files`
+		///
+		/// # Errors
+		/// Returns an error if opening the next file fails, in which case this keeps writing to
+		/// the current file
+		///
+		/// @return `true` on success, `FileCreationError` on error
+		[[nodiscard]] inline auto open_next_file() noexcept -> Result<bool, FileCreationError> {
+			const auto time_string = TimeStampCache::instance().time_stamp(std::time(nullptr));
+			auto path = m_directory;
+			path.append(
+				fmt::format("{} {}.{}.log", time_string.view(), m_root_file_name, m_file_index));
+
+			auto file = OutputFilePointer();
+			try {
+				file = std::make_unique<fmt::ostream>(fmt::output_file(path.string()));
+			}
+			catch(const fmt::system_error& error) {
+				return Err(
+					FileCreationError(std::error_code(error.error_code(), std::generic_category()),
+									  FileCreationErrorCategory::FileCreationFailed));
+			}
+
+			// the new file is open, so we can let go of the old one
+			std::swap(m_file, file);
+			if(file != nullptr) {
+				file->close();
+			}
+
+			++m_file_index;
+			m_bytes_written = 0_usize;
+			m_opened_at = std::chrono::steady_clock::now();
+			m_files.push_back(std::move(path));
+			while(m_rotation.max_files != 0_usize && m_files.size() > m_rotation.max_files) {
+				auto error = std::error_code();
+				std::filesystem::remove(m_files.front(), error);
+				m_files.pop_front();
+			}
+
+			return Ok(true);
+		}
+
+		inline auto buffer_entry(const Entry& entry) noexcept -> void {
+			if constexpr(Style == SinkTextStyle::Styled) {
+				// the styled text is longer than the entry, so it has to be rendered before we
+				// know whether it fits in the current file
+				auto styled = fmt::memory_buffer();
+				fmt::format_to(std::back_inserter(styled), entry.style(), "{}", entry.entry());
+				buffer_text(std::string_view(styled.data(), styled.size()));
+			}
+			else {
+				buffer_text(entry.entry());
+			}
+		}
+
+		inline auto buffer_text(std::string_view text) noexcept -> void {
+			if(should_rotate(text.size())) {
+				// what's already buffered belongs in the current file
+				write_buffer();
+				std::ignore = open_next_file().is_ok();
+			}
+
+			if(m_buffer.size() == 0_usize) {
+				m_first_buffered = std::chrono::steady_clock::now();
+			}
+			m_buffer.append(text);
+		}
+
+		inline auto flush_if_needed() noexcept -> void {
+			if(m_buffer.size() >= m_threshold.bytes
+			   || std::chrono::steady_clock::now() - m_first_buffered >= m_threshold.interval)
+			{
+				flush_entries();
+			}
+		}
 
 		/// @brief Returns the system temporary files directory
 		///
@@ -216,16 +493,774 @@ namespace hyperion {
 				return Ok(subdirectory_path);
 			}
 		}
+	};
+
+	/// @brief Logging Sink type to sink to a file in the compact binary format described in
+	/// "BinaryLog.h", instead of as text. Use `binary_log::decode` to turn the file back into text.
+	///
+	/// When sunk to by a `Logger` configured with `LogFormatting::Deferred`, entries are never
+	/// formatted: each is written as the id of its format string, its level, thread id, raw
+	/// timestamp, and packed arguments. Each format string is written to the file once, the
+	/// first time an entry using it is sunk, so a typical entry only takes a few dozen bytes.
+	/// Entries that have already been formatted are written as text.
+	///
+	/// Records are buffered and written to the file as configured by the sink's
+	/// `FileFlushThreshold`, the same as `FileSink`
+	class BinaryFileSink final : public SinkBase<BinaryFileSink> {
+	  public:
+		BinaryFileSink() noexcept = delete;
+		explicit BinaryFileSink(OutputFilePointer&& file, // NOLINT
+								FileFlushThreshold threshold = FileFlushThreshold()) noexcept
+			: m_file(std::forward<OutputFilePointer>(file)), m_threshold(threshold) {
+			m_buffer.append(binary_log::MAGIC.data(),
+							binary_log::MAGIC.data() + binary_log::MAGIC.size()); // NOLINT
+		}
+		BinaryFileSink(const BinaryFileSink& sink) noexcept = delete;
+		BinaryFileSink(BinaryFileSink&& sink) noexcept = default;
+		~BinaryFileSink() noexcept {
+			if(m_file != nullptr) {
+				flush_entries();
+				m_file->close();
+			}
+		}
+
+		/// @brief Sinks the given already formatted entry, writing it to the file associated
+		/// with this as a text record
+		///
+		/// @param entry - The entry to sink
+		inline auto sink_entry(const Entry& entry) noexcept -> void {
+			write_text(entry);
+			flush_if_needed();
+		}
 
-		/// @brief Creates a time stamp in the format
-		/// [Year-Month-Day|Hour-Minute-Second] for the current local time
+		/// @brief Sinks the given already formatted entry, writing it to the file associated
+		/// with this as a text record
 		///
-		/// @return The time stamp
-		[[nodiscard]] inline static auto create_time_stamp() noexcept -> std::string {
-			return fmt::format("[{:%Y-%m-%d|%H-%M-%S}]", fmt::localtime(std::time(nullptr)));
+		/// @param entry - The entry to sink
+		inline auto sink_entry(Entry&& entry) noexcept -> void {
+			write_text(entry);
+			flush_if_needed();
+		}
+
+		/// @brief Sinks the given not yet formatted entries, writing them to the file associated
+		/// with this without formatting them
+		///
+		/// @param entries - The entries to sink
+		///
+		/// @return The number of bytes the entries were encoded to
+		inline auto sink_deferred_entries(Span<const DeferredEntry> entries) noexcept -> usize {
+			const auto start = m_buffer.size();
+			for(const auto& entry : entries) {
+				write_deferred(entry);
+			}
+			const auto bytes = m_buffer.size() - start;
+			flush_if_needed();
+			return bytes;
+		}
+
+		/// @brief Writes any buffered records to the file associated with this
+		inline auto flush_entries() noexcept -> void {
+			if(m_buffer.size() == 0_usize) {
+				return;
+			}
+
+			m_file->print("{}", std::string_view(m_buffer.data(), m_buffer.size()));
+			m_file->flush();
+			m_buffer.clear();
+		}
+
+		auto operator=(const BinaryFileSink& sink) noexcept -> BinaryFileSink& = delete;
+		auto operator=(BinaryFileSink&& sink) noexcept -> BinaryFileSink& {
+			if(this == &sink) {
+				return *this;
+			}
+
+			if(m_file != nullptr) {
+				flush_entries();
+			}
+			m_file = std::move(sink.m_file);
+			m_threshold = sink.m_threshold;
+			m_buffer = std::move(sink.m_buffer);
+			m_first_buffered = sink.m_first_buffered;
+			m_format_ids = std::move(sink.m_format_ids);
+			m_system_start = sink.m_system_start;
+			m_steady_start = sink.m_steady_start;
+			return *this;
+		}
+
+	  private:
+		/// @brief The format string already formatted `DeferredEntry`s are written with
+		static constexpr std::string_view FORMATTED_TEXT = "{}";
+
+		OutputFilePointer m_file;
+		FileFlushThreshold m_threshold = FileFlushThreshold();
+		fmt::memory_buffer m_buffer = fmt::memory_buffer();
+		std::chrono::steady_clock::time_point m_first_buffered
+			= std::chrono::steady_clock::time_point();
+		// deferred format strings are compile-time format strings, whose text is a string
+		// literal, so they're identified by their address
+		std::unordered_map<const char*, u32> m_format_ids = std::unordered_map<const char*, u32>();
+		// deferred entries carry a `steady_clock` timestamp, so we need a reference point to
+		// convert them to wall-clock time
+		std::chrono::system_clock::time_point m_system_start = std::chrono::system_clock::now();
+		DeferredEntry::clock::time_point m_steady_start = DeferredEntry::clock::now();
+
+		inline auto start_record(binary_log::RecordKind kind) noexcept -> void {
+			if(m_buffer.size() == 0_usize) {
+				m_first_buffered = std::chrono::steady_clock::now();
+			}
+			binary_log::write(m_buffer, kind);
+		}
+
+		inline auto write_text(const Entry& entry) noexcept -> void {
+			start_record(binary_log::RecordKind::Text);
+			binary_log::write(m_buffer, entry.level());
+			binary_log::write_string(m_buffer, entry.entry());
+		}
+
+		inline auto write_deferred(const DeferredEntry& entry) noexcept -> void {
+			const auto format_string
+				= entry.is_deferred() ? entry.format_string() : FORMATTED_TEXT;
+			const auto id = format_id(format_string);
+
+			start_record(binary_log::RecordKind::Entry);
+			binary_log::write(m_buffer, id);
+			binary_log::write(m_buffer, entry.level());
+			binary_log::write(m_buffer, static_cast<u64>(entry.thread_id()));
+			const auto time = m_system_start + (entry.timestamp() - m_steady_start);
+			binary_log::write(m_buffer,
+							  static_cast<i64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+												   time.time_since_epoch())
+												   .count()));
+			if(entry.is_deferred()) {
+				entry.encode_arguments_to(m_buffer);
+			}
+			else {
+				binary_log::write(m_buffer, u8(1));
+				binary_log::write(m_buffer, binary_log::ArgumentType::String);
+				binary_log::write_string(m_buffer, entry.formatted());
+			}
+		}
+
+		/// @brief Returns the id of `format_string`, writing a record registering it first if
+		/// this is the first time it's been used
+		[[nodiscard]] inline auto format_id(std::string_view format_string) noexcept -> u32 {
+			const auto [iter, inserted] = m_format_ids.try_emplace(
+				format_string.data(),
+				static_cast<u32>(m_format_ids.size()));
+			if(inserted) {
+				start_record(binary_log::RecordKind::Format);
+				binary_log::write(m_buffer, iter->second);
+				binary_log::write_string(m_buffer, format_string);
+			}
+			return iter->second;
+		}
+
+		inline auto flush_if_needed() noexcept -> void {
+			if(m_buffer.size() >= m_threshold.bytes
+			   || std::chrono::steady_clock::now() - m_first_buffered >= m_threshold.interval)
+			{
+				flush_entries();
+			}
 		}
 	};
 
+	/// @brief Logging Sink type to sink entries to a file as JSON lines: one JSON object per
+	/// entry, each on its own line, ie:
+	///
+	/// `{"time":"2021-08-10|12-30-15","thread":1,"level":"INFO","message":"done","status":200}`
+	///
+	/// Each entry's `Field`s are written as members of its object, after its time stamp, thread
+	/// id, level, and message, with their types preserved: numbers and booleans as JSON numbers
+	/// and booleans, and everything else as strings. Entries not created by a `Logger` have no
+	/// time stamp or thread id, so those members are left out.
+	///
+	/// Entries are serialized straight into a reusable buffer, which is written to the file as
+	/// configured by the sink's `FileFlushThreshold`, the same as `FileSink`
+	class JsonSink final : public SinkBase<JsonSink> {
+	  public:
+		JsonSink() noexcept = delete;
+		explicit JsonSink(OutputFilePointer&& file, // NOLINT
+						  FileFlushThreshold threshold = FileFlushThreshold()) noexcept
+			: m_file(std::forward<OutputFilePointer>(file)), m_threshold(threshold) {
+		}
+		JsonSink(const JsonSink& sink) noexcept = delete;
+		JsonSink(JsonSink&& sink) noexcept = default;
+		~JsonSink() noexcept {
+			if(m_file != nullptr) {
+				flush_entries();
+				m_file->close();
+			}
+		}
+
+		/// @brief Sinks the given entry, writing it to the file associated with this as a JSON
+		/// object
+		///
+		/// @param entry - The entry to sink
+		inline auto sink_entry(const Entry& entry) noexcept -> void {
+			write_entry(entry);
+			flush_if_needed();
+		}
+
+		/// @brief Sinks the given entry, writing it to the file associated with this as a JSON
+		/// object
+		///
+		/// @param entry - The entry to sink
+		inline auto sink_entry(Entry&& entry) noexcept -> void {
+			write_entry(entry);
+			flush_if_needed();
+		}
+
+		/// @brief Writes any buffered entries to the file associated with this
+		inline auto flush_entries() noexcept -> void {
+			if(m_buffer.size() == 0_usize) {
+				return;
+			}
+
+			m_file->print("{}", std::string_view(m_buffer.data(), m_buffer.size()));
+			m_file->flush();
+			m_buffer.clear();
+		}
+
+		auto operator=(const JsonSink& sink) noexcept -> JsonSink& = delete;
+		auto operator=(JsonSink&& sink) noexcept -> JsonSink& {
+			if(this == &sink) {
+				return *this;
+			}
+
+			if(m_file != nullptr) {
+				flush_entries();
+			}
+			m_file = std::move(sink.m_file);
+			m_threshold = sink.m_threshold;
+			m_buffer = std::move(sink.m_buffer);
+			m_first_buffered = sink.m_first_buffered;
+			return *this;
+		}
+
+	  private:
+		OutputFilePointer m_file;
+		FileFlushThreshold m_threshold = FileFlushThreshold();
+		fmt::memory_buffer m_buffer = fmt::memory_buffer();
+		std::chrono::steady_clock::time_point m_first_buffered
+			= std::chrono::steady_clock::time_point();
+
+		inline auto write_entry(const Entry& entry) noexcept -> void {
+			if(m_buffer.size() == 0_usize) {
+				m_first_buffered = std::chrono::steady_clock::now();
+			}
+
+			m_buffer.push_back('{');
+			if(entry.is_logged()) {
+				// the time stamp is rendered between brackets
+				auto time_stamp = entry.time_stamp();
+				if(time_stamp.size() >= 2_usize && time_stamp.front() == '['
+				   && time_stamp.back() == ']') {
+					time_stamp = time_stamp.substr(1_usize, time_stamp.size() - 2_usize);
+				}
+				write_key("time");
+				write_string(time_stamp);
+				m_buffer.push_back(',');
+				write_key("thread");
+				fmt::format_to(std::back_inserter(m_buffer), "{}", entry.thread_id());
+				m_buffer.push_back(',');
+			}
+			write_key("level");
+			write_string(log_level_name(entry.level()));
+			m_buffer.push_back(',');
+			write_key("message");
+			auto message = entry.message();
+			if(!entry.is_logged() && message.ends_with('\n')) {
+				message.remove_suffix(1_usize);
+			}
+			write_string(message);
+
+			entry.for_each_field([this](std::string_view key, const FieldValue& value) {
+				m_buffer.push_back(',');
+				write_key(key);
+				std::visit([this](const auto& val) { write_value(val); }, value);
+			});
+			m_buffer.append(std::string_view("}\n"));
+		}
+
+		inline auto write_key(std::string_view key) noexcept -> void {
+			write_string(key);
+			m_buffer.push_back(':');
+		}
+
+		template<typename T>
+		inline auto write_value(const T& value) noexcept -> void {
+			if constexpr(concepts::Same<T, bool>) {
+				m_buffer.append(value ? std::string_view("true") : std::string_view("false"));
+			}
+			else if constexpr(concepts::Same<T, char>) {
+				write_string(std::string_view(&value, 1_usize));
+			}
+			else if constexpr(concepts::Same<T, std::string_view>) {
+				write_string(value);
+			}
+			else if constexpr(concepts::Same<T, double>) {
+				// JSON has no representation for infinities or NaN
+				if(std::isfinite(value)) {
+					fmt::format_to(std::back_inserter(m_buffer), "{}", value);
+				}
+				else {
+					m_buffer.append(std::string_view("null"));
+				}
+			}
+			else {
+				fmt::format_to(std::back_inserter(m_buffer), "{}", value);
+			}
+		}
+
+		/// @brief Appends `string` to the buffer as a quoted, escaped JSON string
+		inline auto write_string(std::string_view string) noexcept -> void {
+			static constexpr std::string_view hex_digits = "0123456789abcdef";
+
+			m_buffer.push_back('"');
+			// append runs of characters that don't need escaping all at once
+			auto run_start = 0_usize;
+			for(auto i = 0_usize; i < string.size(); ++i) {
+				const auto character = static_cast<unsigned char>(string[i]);
+				if(character >= 0x20U && character != '"' && character != '\\') {
+					continue;
+				}
+
+				m_buffer.append(string.substr(run_start, i - run_start));
+				run_start = i + 1_usize;
+				m_buffer.push_back('\\');
+				switch(character) {
+					case '"': m_buffer.push_back('"'); break;
+					case '\\': m_buffer.push_back('\\'); break;
+					case '\n': m_buffer.push_back('n'); break;
+					case '\r': m_buffer.push_back('r'); break;
+					case '\t': m_buffer.push_back('t'); break;
+					case '\b': m_buffer.push_back('b'); break;
+					case '\f': m_buffer.push_back('f'); break;
+					default:
+						m_buffer.append(std::string_view("u00"));
+						m_buffer.push_back(hex_digits[character >> 4U]);	 // NOLINT
+						m_buffer.push_back(hex_digits[character & 0x0FU]); // NOLINT
+				}
+			}
+			m_buffer.append(string.substr(run_start));
+			m_buffer.push_back('"');
+		}
+
+		inline auto flush_if_needed() noexcept -> void {
+			if(m_buffer.size() >= m_threshold.bytes
+			   || std::chrono::steady_clock::now() - m_first_buffered >= m_threshold.interval)
+			{
+				flush_entries();
+			}
+		}
+	};
+
+#ifdef HYPERION_HAS_MAPPED_FILE_SINK
+	/// @brief Logging Sink type to sink to a memory-mapped file
+	///
+	/// The file is grown and mapped one segment at a time, and entries are appended by copying
+	/// them into the mapping, so sinking an entry doesn't make a system call unless it fills the
+	/// current segment. Because the mapped pages belong to the kernel's page cache, entries that
+	/// have been sunk still make it to the file if the process crashes. When the sink is destroyed
+	/// the file is truncated to the length actually written; after a crash, the unused remainder
+	/// of the last segment is left as zero bytes.
+	///
+	/// If growing or mapping the file fails, entries sunk after that point are dropped
+	class MappedFileSink final : public SinkBase<MappedFileSink> {
+	  public:
+		/// @brief The default size of the segments the file is grown and mapped by
+		static constexpr usize DEFAULT_SEGMENT_SIZE = 16_usize * 1024_usize * 1024_usize; // NOLINT
+
+		MappedFileSink() noexcept = delete;
+		MappedFileSink(const MappedFileSink& sink) noexcept = delete;
+		MappedFileSink(MappedFileSink&& sink) noexcept
+			: m_file(std::exchange(sink.m_file, -1)),
+			  m_segment_size(sink.m_segment_size),
+			  m_segment_offset(sink.m_segment_offset),
+			  m_mapping(std::exchange(sink.m_mapping, nullptr)),
+			  m_position(sink.m_position) {
+		}
+		~MappedFileSink() noexcept {
+			close();
+		}
+
+		/// @brief Creates a `MappedFileSink` writing to the file at `path`, replacing any
+		/// existing file
+		///
+		/// # Errors
+		/// Returns an Error if creating, growing, or mapping the file fails
+		///
+		/// @param path - The path of the file to write to
+		/// @param segment_size - The size of the segments to grow and map the file by. Rounded up
+		/// to a multiple of the page size
+		///
+		/// @return The `MappedFileSink` on success, `FileCreationError` on error
+		[[nodiscard]] inline static auto
+		create_file(const std::filesystem::path& path,
+					usize segment_size = DEFAULT_SEGMENT_SIZE) noexcept
+			-> Result<MappedFileSink, FileCreationError> {
+			const auto page_size = static_cast<usize>(sysconf(_SC_PAGESIZE));
+			segment_size = std::max(page_size,
+									(segment_size + page_size - 1_usize) / page_size * page_size);
+
+			const auto file
+				= ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644); // NOLINT
+			if(file < 0) {
+				return Err(last_error());
+			}
+
+			auto sink = MappedFileSink(file, segment_size);
+			if(!sink.map_segment(0_usize)) {
+				return Err(last_error());
+			}
+
+			return Ok(std::move(sink));
+		}
+
+		/// @brief Sinks the given entry, appending it to the file associated with this
+		///
+		/// @param entry - The entry to sink
+		inline auto sink_entry(const Entry& entry) noexcept -> void {
+			append(entry.entry());
+		}
+
+		/// @brief Sinks the given entry, appending it to the file associated with this
+		///
+		/// @param entry - The entry to sink
+		inline auto sink_entry(Entry&& entry) noexcept -> void {
+			append(entry.entry());
+		}
+
+		auto operator=(const MappedFileSink& sink) noexcept -> MappedFileSink& = delete;
+		auto operator=(MappedFileSink&& sink) noexcept -> MappedFileSink& {
+			if(this == &sink) {
+				return *this;
+			}
+
+			close();
+			m_file = std::exchange(sink.m_file, -1);
+			m_segment_size = sink.m_segment_size;
+			m_segment_offset = sink.m_segment_offset;
+			m_mapping = std::exchange(sink.m_mapping, nullptr);
+			m_position = sink.m_position;
+			return *this;
+		}
+
+	  private:
+		int m_file = -1;
+		usize m_segment_size = DEFAULT_SEGMENT_SIZE;
+		usize m_segment_offset = 0_usize;
+		char* m_mapping = nullptr;
+		usize m_position = 0_usize;
+
+		MappedFileSink(int file, usize segment_size) noexcept
+			: m_file(file), m_segment_size(segment_size) {
+		}
+
+		[[nodiscard]] inline static auto last_error() noexcept -> FileCreationError {
+			return {std::error_code(errno, std::generic_category()),
+					FileCreationErrorCategory::FileCreationFailed};
+		}
+
+		/// @brief Grows the file to fit the segment starting at `offset`, and maps it
+		///
+		/// @return Whether the segment was mapped
+		[[nodiscard]] inline auto map_segment(usize offset) noexcept -> bool {
+			if(ftruncate(m_file, static_cast<off_t>(offset + m_segment_size)) != 0) {
+				return false;
+			}
+
+			auto* mapping = mmap(nullptr,
+								 m_segment_size,
+								 PROT_READ | PROT_WRITE, // NOLINT
+								 MAP_SHARED,
+								 m_file,
+								 static_cast<off_t>(offset));
+			if(mapping == MAP_FAILED) { // NOLINT
+				return false;
+			}
+
+			m_mapping = static_cast<char*>(mapping);
+			m_segment_offset = offset;
+			m_position = 0_usize;
+			return true;
+		}
+
+		inline auto append(std::string_view text) noexcept -> void {
+			while(!text.empty() && m_mapping != nullptr) {
+				if(m_position == m_segment_size) {
+					munmap(m_mapping, m_segment_size);
+					m_mapping = nullptr;
+					if(!map_segment(m_segment_offset + m_segment_size)) {
+						// leave the file at the length we managed to write
+						m_position = m_segment_size;
+						return;
+					}
+				}
+
+				const auto count = std::min(text.size(), m_segment_size - m_position);
+				std::copy_n(text.data(), count, m_mapping + m_position); // NOLINT
+				m_position += count;
+				text.remove_prefix(count);
+			}
+		}
+
+		inline auto close() noexcept -> void {
+			if(m_file < 0) {
+				return;
+			}
+
+			if(m_mapping != nullptr) {
+				munmap(m_mapping, m_segment_size);
+				m_mapping = nullptr;
+			}
+			// trim the unused remainder of the last segment
+			std::ignore = ftruncate(m_file, static_cast<off_t>(m_segment_offset + m_position));
+			::close(m_file);
+			m_file = -1;
+		}
+	};
+#endif
+
+#ifdef HYPERION_HAS_ASYNC_FILE_SINK
+	/// @brief How many buffers an `AsyncFileSink` writes entries through, and how large they are
+	struct AsyncFileBuffers {
+		/// @brief The size of each buffer. A buffer is submitted to be written once it's full
+		usize size = 64_usize * 1024_usize; // NOLINT
+		/// @brief The number of buffers. Clamped to [2, `AsyncFileSink::MAX_BUFFERS`]
+		usize count = 4_usize;
+	};
+
+	/// @brief Logging Sink type to sink to a file without blocking on writes to it
+	///
+	/// Entries are appended to one buffer while the sink's other buffers are being written to
+	/// the file in the background, with io_uring when HyperionUtils is built with
+	/// `HYPERION_USE_IO_URING` and the kernel supports it, or by a dedicated writer thread
+	/// otherwise. A buffer is submitted once it fills up, or when the logger sinking to this
+	/// runs out of entries to sink.
+	///
+	/// When every buffer is still being written, sinking blocks until one is done, and the sink
+	/// reports that it's backed up, which the `Logger` sinking to it surfaces through
+	/// `Logger::sinks_backed_up`
+	class AsyncFileSink final : public SinkBase<AsyncFileSink> {
+	  public:
+		/// @brief The maximum number of buffers an `AsyncFileSink` can have
+		static constexpr usize MAX_BUFFERS = detail::MAX_ASYNC_FILE_BUFFERS;
+
+		AsyncFileSink() noexcept = delete;
+		AsyncFileSink(const AsyncFileSink& sink) noexcept = delete;
+		AsyncFileSink(AsyncFileSink&& sink) noexcept = default;
+		~AsyncFileSink() noexcept {
+			if(m_state != nullptr) {
+				flush_entries();
+			}
+		}
+
+		/// @brief Creates an `AsyncFileSink` writing to the file at `path`, replacing any
+		/// existing file
+		///
+		/// # Errors
+		/// Returns an Error if creating the file fails
+		///
+		/// @param path - The path of the file to write to
+		/// @param buffers - The number and size of buffers to write through
+		///
+		/// @return The `AsyncFileSink` on success, `FileCreationError` on error
+		[[nodiscard]] inline static auto
+		create_file(const std::filesystem::path& path,
+					AsyncFileBuffers buffers = AsyncFileBuffers()) noexcept
+			-> Result<AsyncFileSink, FileCreationError> {
+			const auto file
+				= ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644); // NOLINT
+			if(file < 0) {
+				return Err(FileCreationError(std::error_code(errno, std::generic_category()),
+											 FileCreationErrorCategory::FileCreationFailed));
+			}
+
+			return Ok(AsyncFileSink(std::make_unique<State>(
+				file,
+				std::max(buffers.size, 1_usize),
+				std::clamp(buffers.count, 2_usize, MAX_BUFFERS))));
+		}
+
+		/// @brief Sinks the given entry, writing it to the file associated with this
+		///
+		/// @param entry - The entry to sink
+		inline auto sink_entry(const Entry& entry) noexcept -> void {
+			append(entry.entry());
+		}
+
+		/// @brief Sinks the given entry, writing it to the file associated with this
+		///
+		/// @param entry - The entry to sink
+		inline auto sink_entry(Entry&& entry) noexcept -> void {
+			append(entry.entry());
+		}
+
+		/// @brief Submits the buffer currently being appended to to be written to the file
+		inline auto flush_entries() noexcept -> void {
+			submit_active();
+		}
+
+		/// @brief Returns whether every buffer was still being written the last time this
+		/// needed a new one. Safe to call from any thread
+		///
+		/// @return Whether this sink is backed up
+		[[nodiscard]] inline auto backed_up() const noexcept -> bool {
+			return m_state->backed_up.load(std::memory_order_relaxed);
+		}
+
+		/// @brief Returns whether this sink writes with io_uring
+		///
+		/// @return Whether io_uring is used
+		[[nodiscard]] inline auto uses_io_uring() const noexcept -> bool {
+			return m_state->uses_io_uring();
+		}
+
+		auto operator=(const AsyncFileSink& sink) noexcept -> AsyncFileSink& = delete;
+		auto operator=(AsyncFileSink&& sink) noexcept -> AsyncFileSink& {
+			if(this == &sink) {
+				return *this;
+			}
+
+			if(m_state != nullptr) {
+				flush_entries();
+			}
+			m_state = std::move(sink.m_state);
+			return *this;
+		}
+
+	  private:
+		IGNORE_PADDING_START
+		/// @brief Everything the writer has to find at a stable address
+		struct State {
+			State(int _file, usize buffer_size, usize num_buffers) noexcept
+				: file(_file), buffers(num_buffers) {
+				for(auto& buffer : buffers) {
+					buffer.reserve(buffer_size);
+				}
+				for(auto i = num_buffers - 1_usize; i > 0_usize; --i) {
+					free.push_back(i);
+				}
+	#ifdef HYPERION_HAS_IO_URING
+				uring = std::make_unique<detail::UringFileWriter>(file, num_buffers);
+				if(!uring->initialized()) {
+					uring = nullptr;
+				}
+	#endif
+				if(!uses_io_uring()) {
+					thread_writer = std::make_unique<detail::ThreadFileWriter>(file);
+				}
+			}
+			State(const State& state) = delete;
+			State(State&& state) = delete;
+			~State() noexcept {
+				// the writers finish writing everything submitted to them before they're destroyed
+	#ifdef HYPERION_HAS_IO_URING
+				uring = nullptr;
+	#endif
+				thread_writer = nullptr;
+				::close(file);
+			}
+
+			[[nodiscard]] inline auto uses_io_uring() const noexcept -> bool {
+	#ifdef HYPERION_HAS_IO_URING
+				return uring != nullptr;
+	#else
+				return false;
+	#endif
+			}
+
+			auto operator=(const State& state) -> State& = delete;
+			auto operator=(State&& state) -> State& = delete;
+
+			int file;
+			std::vector<std::vector<char>> buffers;
+			// the buffers that are neither being appended to nor written
+			std::vector<usize> free = std::vector<usize>();
+			usize active = 0_usize;
+			std::atomic<bool> backed_up = false;
+	#ifdef HYPERION_HAS_IO_URING
+			std::unique_ptr<detail::UringFileWriter> uring = nullptr;
+	#endif
+			std::unique_ptr<detail::ThreadFileWriter> thread_writer = nullptr;
+		};
+		IGNORE_PADDING_STOP
+
+		std::unique_ptr<State> m_state;
+
+		explicit AsyncFileSink(std::unique_ptr<State>&& state) noexcept
+			: m_state(std::move(state)) {
+		}
+
+		inline auto append(std::string_view text) noexcept -> void {
+			auto* buffer = &m_state->buffers[m_state->active];
+			if(buffer->size() + text.size() > buffer->capacity() && !buffer->empty()) {
+				submit_active();
+				buffer = &m_state->buffers[m_state->active];
+			}
+			// an entry larger than a whole buffer grows the buffer to fit it
+			buffer->insert(buffer->end(), text.begin(), text.end());
+		}
+
+		/// @brief Submits the active buffer to be written, and moves on to a free one
+		inline auto submit_active() noexcept -> void {
+			auto& state = *m_state;
+			auto& buffer = state.buffers[state.active];
+			if(buffer.empty()) {
+				return;
+			}
+
+			const auto write = detail::AsyncFileWrite{.index = state.active,
+													  .data = buffer.data(),
+													  .size = buffer.size()};
+	#ifdef HYPERION_HAS_IO_URING
+			if(state.uses_io_uring()) {
+				state.uring->submit(write);
+			}
+			else {
+				state.thread_writer->submit(write);
+			}
+	#else
+			state.thread_writer->submit(write);
+	#endif
+			acquire_buffer();
+		}
+
+		/// @brief Makes a free buffer the active one, waiting for one to finish being written if
+		/// none are free
+		inline auto acquire_buffer() noexcept -> void {
+			auto& state = *m_state;
+			for(auto written = reap(false); written.is_some(); written = reap(false)) {
+				state.free.push_back(written.unwrap());
+			}
+
+			const auto backed_up = state.free.empty();
+			state.backed_up.store(backed_up, std::memory_order_relaxed);
+			while(state.free.empty()) {
+				auto written = reap(true);
+				if(written.is_some()) {
+					state.free.push_back(written.unwrap());
+				}
+			}
+
+			state.active = state.free.back();
+			state.free.pop_back();
+			state.buffers[state.active].clear();
+		}
+
+		[[nodiscard]] inline auto reap(bool block) noexcept -> Option<usize> {
+	#ifdef HYPERION_HAS_IO_URING
+			if(m_state->uses_io_uring()) {
+				return m_state->uring->reap(block);
+			}
+	#endif
+			return m_state->thread_writer->reap(block);
+		}
+	};
+#endif
+
 	/// @brief Logging Sink type to sink to stdout
 	///
 	/// @tparam Style - Whether the text should be styled
@@ -242,10 +1277,10 @@ namespace hyperion {
 		/// @param entry - The entry to sink
 		inline auto sink_entry(const Entry& entry) noexcept -> void {
 			if constexpr(Style == SinkTextStyle::Styled) {
-				fmt::print(stdout, entry.style(), entry.entry());
+				fmt::print(stdout, entry.style(), "{}", entry.entry());
 			}
 			else {
-				fmt::print(stdout, entry.entry());
+				fmt::print(stdout, "{}", entry.entry());
 			}
 		}
 
@@ -254,10 +1289,10 @@ namespace hyperion {
 		/// @param entry - The entry to sink
 		inline auto sink_entry(Entry&& entry) noexcept -> void {
 			if constexpr(Style == SinkTextStyle::Styled) {
-				fmt::print(stdout, entry.style(), entry.entry());
+				fmt::print(stdout, entry.style(), "{}", entry.entry());
 			}
 			else {
-				fmt::print(stdout, entry.entry());
+				fmt::print(stdout, "{}", entry.entry());
 			}
 		}
 
@@ -281,10 +1316,10 @@ namespace hyperion {
 		/// @param entry - The entry to sink
 		inline auto sink_entry(const Entry& entry) noexcept -> void {
 			if constexpr(Style == SinkTextStyle::Styled) {
-				fmt::print(stderr, entry.style(), entry.entry());
+				fmt::print(stderr, entry.style(), "{}", entry.entry());
 			}
 			else {
-				fmt::print(stderr, entry.entry());
+				fmt::print(stderr, "{}", entry.entry());
 			}
 		}
 
@@ -293,10 +1328,10 @@ namespace hyperion {
 		/// @param entry - The entry to sink
 		inline auto sink_entry(Entry&& entry) noexcept -> void {
 			if constexpr(Style == SinkTextStyle::Styled) {
-				fmt::print(stderr, entry.style(), entry.entry());
+				fmt::print(stderr, entry.style(), "{}", entry.entry());
 			}
 			else {
-				fmt::print(stderr, entry.entry());
+				fmt::print(stderr, "{}", entry.entry());
 			}
 		}
 
@@ -306,7 +1341,14 @@ namespace hyperion {
 
 #ifndef HYPERION_LOGGING_SINKS
 	/// List of Sink types to sink logging entries to
-	#define HYPERION_LOGGING_SINKS FileSink<>, StdoutSink<>, StderrSink<> // NOLINT
+	#ifdef HYPERION_HAS_MAPPED_FILE_SINK
+		#define HYPERION_LOGGING_SINKS                                                             \
+			FileSink<>, BinaryFileSink, JsonSink, MappedFileSink, AsyncFileSink, StdoutSink<>, \
+				StderrSink<> // NOLINT
+	#else
+		#define HYPERION_LOGGING_SINKS \
+			FileSink<>, BinaryFileSink, JsonSink, StdoutSink<>, StderrSink<> // NOLINT
+	#endif
 #endif
 
 	/// @brief Universal Hyperion logging Sink type.
@@ -319,7 +1361,9 @@ namespace hyperion {
 	/// (`HyperionUtils/logging/Sinks.h`) and/or the HyperionUtils logging header
 	/// (`HyperionUtils/Logger.h`) and/or the global HyperionUtils header
 	/// (`HyperionUtils/HyperionUtils.h`).
-	/// The default value of this macro is: `FileSink<>, StdoutSink<>, StderrSink<>`
+	/// The default value of this macro is: `FileSink<>, BinaryFileSink, JsonSink, StdoutSink<>,
+	/// StderrSink<>`, with `MappedFileSink` and `AsyncFileSink` added after `JsonSink` on
+	/// platforms that support them
 	///
 	/// TODO: replace std::variant with our own custom variant-like type that can't be valueless
 	class Sink {
@@ -367,6 +1411,50 @@ namespace hyperion {
 			std::visit([&](auto& sink) { sink.sink(std::forward<Entry>(entry)); }, m_inner);
 		}
 
+		/// @brief Sinks the given batch of entries, in order, writing them to the output
+		/// location corresponding with the current value of this
+		///
+		/// @param entries - The entries to sink
+		///
+		/// @return The number of bytes of text sunk
+		inline constexpr auto sink_batch(Span<const Entry> entries) noexcept -> usize {
+			return std::visit([&](auto& sink) { return sink.sink_batch(entries); }, m_inner);
+		}
+
+		/// @brief Returns whether the current value of this can sink `DeferredEntry`s without
+		/// them being formatted first
+		///
+		/// @return Whether `sink_deferred_batch` can be used with this
+		[[nodiscard]] inline constexpr auto accepts_deferred() const noexcept -> bool {
+			return std::visit([](const auto& sink) { return sink.accepts_deferred(); }, m_inner);
+		}
+
+		/// @brief Sinks the given batch of not yet formatted entries, in order, writing them to
+		/// the output location corresponding with the current value of this. Does nothing
+		/// unless `accepts_deferred`
+		///
+		/// @param entries - The entries to sink
+		///
+		/// @return The number of bytes the entries took up in the sink's output
+		inline constexpr auto sink_deferred_batch(Span<const DeferredEntry> entries) noexcept
+			-> usize {
+			return std::visit([&](auto& sink) { return sink.sink_deferred_batch(entries); },
+							  m_inner);
+		}
+
+		/// @brief Returns whether the current value of this is currently backed up. Safe to call
+		/// from any thread
+		///
+		/// @return Whether the sink is backed up
+		[[nodiscard]] inline constexpr auto is_backed_up() const noexcept -> bool {
+			return std::visit([](const auto& sink) { return sink.is_backed_up(); }, m_inner);
+		}
+
+		/// @brief Writes out any entries buffered by the current value of this
+		inline constexpr auto flush() noexcept -> void {
+			std::visit([](auto& sink) { sink.flush(); }, m_inner);
+		}
+
 		auto operator=(const Sink& sink) noexcept -> Sink& = delete;
 		auto operator=(Sink&& sink) noexcept -> Sink& = default;
 
@@ -397,6 +1485,7 @@ namespace hyperion {
 		using reverse_iterator = std::vector<Sink>::reverse_iterator;
 		using const_reverse_iterator = std::vector<Sink>::const_reverse_iterator;
 
+		Sinks() noexcept = default;
 		/// @brief Constructs a `Sinks` from an array of rvalue `Sink`s.
 		/// This allows for braced-initialization of a `Sinks` even though `Sink`s
 		/// are not copyable.
@@ -404,7 +1493,9 @@ namespace hyperion {
 		/// @tparam N - The size of the array
 		/// @param sinks - The array of sinks to initialize from
 		template<size_t N>
-		explicit Sinks(Sink(&&sinks)[N]) noexcept : m_sinks(sinks) { // NOLINT
+		explicit Sinks(Sink(&&sinks)[N]) noexcept // NOLINT
+			: m_sinks(std::make_move_iterator(std::begin(sinks)),
+					  std::make_move_iterator(std::end(sinks))) {
 		}
 		Sinks(const Sinks& sinks) noexcept = delete;
 		Sinks(Sinks&& sinks) noexcept = default;
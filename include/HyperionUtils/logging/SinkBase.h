@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../Concepts.h"
+#include "../Span.h"
+#include "DeferredEntry.h"
 #include "Entry.h"
 
 namespace hyperion {
@@ -48,6 +50,88 @@ namespace hyperion {
 			underlying().sink_entry(std::forward<Entry>(entry));
 		}
 
+		/// @brief Sinks the given batch of log entries, in order,
+		/// writing them to the output location associated with this sink.
+		///
+		/// Sink types can make sinking many entries at once cheaper than sinking them one at a
+		/// time by providing `sink_entries(Span<const Entry>)`. Otherwise, each entry is sunk
+		/// with `sink_entry`
+		///
+		/// @param entries - The log entries to sink
+		///
+		/// @return The number of bytes of text sunk
+		inline constexpr auto sink_batch(Span<const Entry> entries) noexcept -> usize {
+			auto bytes = 0_usize;
+			if constexpr(requires(T& sink) { sink.sink_entries(entries); }) {
+				underlying().sink_entries(entries);
+				for(const auto& entry : entries) {
+					bytes += entry.entry().size();
+				}
+			}
+			else {
+				for(const auto& entry : entries) {
+					bytes += entry.entry().size();
+					underlying().sink_entry(entry);
+				}
+			}
+			return bytes;
+		}
+
+		/// @brief Returns whether this sink can sink `DeferredEntry`s as-is, without them being
+		/// formatted first. Sink types opt in to this by providing
+		/// `sink_deferred_entries(Span<const DeferredEntry>)`, returning the number of bytes the
+		/// entries took up in the sink's output
+		///
+		/// @return Whether this sink accepts `DeferredEntry`s
+		[[nodiscard]] inline static constexpr auto accepts_deferred() noexcept -> bool {
+			return requires(T& sink, Span<const DeferredEntry> entries) {
+				sink.sink_deferred_entries(entries);
+			};
+		}
+
+		/// @brief Sinks the given batch of not yet formatted log entries, in order, writing them
+		/// to the output location associated with this sink. Does nothing unless
+		/// `accepts_deferred`
+		///
+		/// @param entries - The log entries to sink
+		///
+		/// @return The number of bytes the entries took up in the sink's output
+		inline constexpr auto sink_deferred_batch(Span<const DeferredEntry> entries) noexcept
+			-> usize {
+			if constexpr(accepts_deferred()) {
+				return underlying().sink_deferred_entries(entries);
+			}
+			else {
+				return 0_usize;
+			}
+		}
+
+		/// @brief Writes out any entries this sink has buffered.
+		/// Called when the logger sinking to this has no more entries to sink for now.
+		///
+		/// Sink types that buffer entries should provide `flush_entries()`
+		inline constexpr auto flush() noexcept -> void {
+			if constexpr(requires(T& sink) { sink.flush_entries(); }) {
+				underlying().flush_entries();
+			}
+		}
+
+		/// @brief Returns whether this sink can't currently keep up with the entries sunk to it
+		/// (ie: writes to its output are still in flight when it needs to start more).
+		/// Must be safe to call from any thread.
+		///
+		/// Sink types that can detect this should provide `backed_up()`
+		///
+		/// @return Whether this sink is backed up
+		[[nodiscard]] inline constexpr auto is_backed_up() const noexcept -> bool {
+			if constexpr(requires(const T& sink) { sink.backed_up(); }) {
+				return underlying().backed_up();
+			}
+			else {
+				return false;
+			}
+		}
+
 	  private:
 		[[nodiscard]] inline constexpr auto underlying() const noexcept -> const SinkType auto& {
 			return static_cast<const T&>(*this);
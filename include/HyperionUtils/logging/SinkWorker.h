@@ -0,0 +1,137 @@
+/// @brief Background thread for sinking entries to a single `Sink`, used by `Logger`s with more
+/// than one `Sink`
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <stop_token>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include "../BasicTypes.h"
+#include "../Concepts.h"
+#include "../LockFreeQueue.h"
+#include "../Macros.h"
+#include "../Span.h"
+#include "DeferredEntry.h"
+#include "Entry.h"
+#include "Sink.h"
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	/// @brief Owns a `Sink` and a thread that sinks entries to it from a single-producer queue.
+	///
+	/// Giving each of a `Logger`'s `Sink`s its own `SinkWorker` means a slow sink (ie: a
+	/// terminal) only holds up the entries queued for it, instead of every other sink, until its
+	/// queue fills up. Entries queued before the worker is destroyed are still sunk
+	///
+	/// @tparam T - The type of entries to queue: `Entry`, or `DeferredEntry` for a sink that
+	/// `accepts_deferred`
+	template<typename T = Entry>
+	requires concepts::Same<T, Entry> || concepts::Same<T, DeferredEntry>
+	class SinkWorker {
+	  public:
+		/// @brief The number of entries that can be queued for the sink before `push` blocks
+		static constexpr usize QUEUE_CAPACITY = 256_usize;
+		/// @brief The maximum number of entries the worker drains from its queue at once
+		static constexpr usize BATCH_SIZE = 64_usize;
+		/// @brief The longest the worker waits for entries before waking to flush the sink
+		/// anyway, so its time-based work (ie: `FileSink` rotation) still happens while nothing
+		/// is logged
+		static constexpr std::chrono::seconds IDLE_WAKE_INTERVAL = std::chrono::seconds(1);
+
+		SinkWorker() noexcept = delete;
+		/// @brief Constructs a `SinkWorker` sinking to `sink`
+		///
+		/// @param sink - The sink to sink entries to
+		/// @param bytes_sunk - The counter to add the number of bytes sunk to `sink` to
+		SinkWorker(Sink&& sink, std::atomic<u64>& bytes_sunk) noexcept
+			: m_sink(std::move(sink)), m_bytes_sunk(bytes_sunk),
+			  m_thread([this](const std::stop_token& stop) { run(stop); }) {
+		}
+		SinkWorker(const SinkWorker& worker) = delete;
+		SinkWorker(SinkWorker&& worker) = delete;
+		~SinkWorker() noexcept = default;
+
+		/// @brief Queues `entry` to be sunk, blocking while the queue is full. The worker isn't
+		/// woken for it until `notify` is called, so a batch of entries only wakes it once.
+		/// Must only be called from one thread
+		///
+		/// @param entry - The entry to sink
+		inline auto push(T&& entry) noexcept -> void {
+			// a failed push doesn't consume `entry`, so it's safe to retry with it
+			while(!m_queue.try_push(std::move(entry))) { // NOLINT(bugprone-use-after-move)
+				// the worker has to be awake to make room
+				m_queue.notify_pushed();
+				m_queue.wait_for_space();
+			}
+		}
+
+		/// @brief Wakes the worker to sink the entries pushed since it was last woken.
+		/// Must be called from the thread calling `push`, after pushing
+		inline auto notify() noexcept -> void {
+			m_queue.notify_pushed();
+		}
+
+		/// @brief Returns whether the worker's queue is full or its sink is backed up
+		///
+		/// @return Whether the worker is backed up
+		[[nodiscard]] inline auto is_backed_up() const noexcept -> bool {
+			return m_queue.full() || m_sink.is_backed_up();
+		}
+
+		auto operator=(const SinkWorker& worker) -> SinkWorker& = delete;
+		auto operator=(SinkWorker&& worker) -> SinkWorker& = delete;
+
+	  private:
+		using Queue
+			= LockFreeQueue<T, QueuePolicy::ErrWhenFull, QUEUE_CAPACITY, QueueConcurrency::SPSC>;
+
+		Sink m_sink;
+		std::atomic<u64>& m_bytes_sunk;
+		Queue m_queue = Queue();
+		// declared last so the thread is joined before the queue and sink are destroyed
+		std::jthread m_thread;
+
+		inline auto run(const std::stop_token& stop) noexcept -> void {
+			auto batch = std::array<T, BATCH_SIZE>();
+			const auto drain = [this, &batch]() {
+				const auto num_read
+					= m_queue.read_n(Span<T>::make_span(batch.data(), batch.size()));
+				if(num_read != 0_usize) {
+					m_queue.notify_popped();
+					auto bytes = 0_usize;
+					if constexpr(concepts::Same<T, DeferredEntry>) {
+						bytes = m_sink.sink_deferred_batch(
+							Span<const DeferredEntry>::make_span(batch.data(), num_read));
+					}
+					else {
+						bytes = m_sink.sink_batch(
+							Span<const Entry>::make_span(batch.data(), num_read));
+					}
+					// this is the only thread writing the counter
+					m_bytes_sunk.store(m_bytes_sunk.load(std::memory_order_relaxed) + bytes,
+									   std::memory_order_relaxed);
+				}
+				return num_read;
+			};
+
+			while(!stop.stop_requested()) {
+				if(drain() == 0_usize) {
+					// we've caught up, so write out anything the sink has buffered before waiting
+					m_sink.flush();
+					std::ignore = m_queue.wait_for_entries(stop, IDLE_WAKE_INTERVAL);
+				}
+			}
+
+			// sink anything queued before we were stopped
+			while(drain() != 0_usize) {
+			}
+			m_sink.flush();
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
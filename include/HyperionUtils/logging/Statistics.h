@@ -0,0 +1,190 @@
+/// @brief Counters tracking what happens to the entries logged by a `Logger`
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "../BasicTypes.h"
+#include "../Macros.h"
+#include "../RingBuffer.h"
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	/// @brief A counter that's incremented from many threads and read rarely.
+	///
+	/// The count is split across shards on separate cache lines, and each thread always
+	/// increments the same shard, so threads logging at the same time rarely contend on the same
+	/// cache line. Reading the count sums the shards
+	class ShardedCounter {
+	  public:
+		/// @brief The number of shards the count is split across
+		static constexpr usize NUM_SHARDS = 16_usize;
+
+		ShardedCounter() noexcept = default;
+		ShardedCounter(const ShardedCounter& counter) = delete;
+		ShardedCounter(ShardedCounter&& counter) = delete;
+		~ShardedCounter() noexcept = default;
+
+		/// @brief Adds `amount` to the count
+		///
+		/// @param amount - The amount to add
+		inline auto add(u64 amount = 1_u64) noexcept -> void {
+			m_shards[shard_index()].value.fetch_add(amount, std::memory_order_relaxed); // NOLINT
+		}
+
+		/// @brief Returns the count at some point during the call
+		///
+		/// @return The count
+		[[nodiscard]] inline auto load() const noexcept -> u64 {
+			auto count = 0_u64;
+			for(const auto& shard : m_shards) {
+				count += shard.value.load(std::memory_order_relaxed);
+			}
+			return count;
+		}
+
+		auto operator=(const ShardedCounter& counter) -> ShardedCounter& = delete;
+		auto operator=(ShardedCounter&& counter) -> ShardedCounter& = delete;
+
+	  private:
+		struct alignas(CACHE_LINE_SIZE) Shard {
+			std::atomic<u64> value = 0_u64;
+		};
+
+		std::array<Shard, NUM_SHARDS> m_shards = {};
+
+		/// @brief Returns the shard the calling thread increments. Threads are assigned shards
+		/// round-robin the first time they increment any `ShardedCounter`
+		[[nodiscard]] inline static auto shard_index() noexcept -> usize {
+			static std::atomic<usize> NEXT_INDEX = 0_usize;
+			thread_local static const usize INDEX
+				= NEXT_INDEX.fetch_add(1_usize, std::memory_order_relaxed) % NUM_SHARDS;
+			return INDEX;
+		}
+	};
+
+	/// @brief A snapshot of the statistics of a `Logger`, as returned by `Logger::stats`
+	struct LoggerStats {
+		/// @brief The number of entries queued to be sunk
+		u64 entries_enqueued = 0_u64;
+		/// @brief The number of entries rejected because the queue was full, with
+		/// `LogPolicy::DropWhenFull`, or stayed full past the flush timeout, with
+		/// `LogPolicy::FlushWhenFull`
+		u64 entries_dropped = 0_u64;
+		/// @brief The number of queued entries discarded to make room for newer ones, with
+		/// `LogPolicy::OverwriteWhenFull`. This is approximate: an entry is counted as
+		/// overwriting another when the queue was full just before it was pushed
+		u64 entries_overwritten = 0_u64;
+		/// @brief The number of entries read from the queue and sunk
+		u64 entries_sunk = 0_u64;
+		/// @brief The number of bytes sunk to each of the `Logger`'s `Sink`s, in the order they
+		/// were given to it
+		std::vector<u64> bytes_sunk = {};
+		/// @brief The most entries the message thread has found in a queue when draining it
+		usize queue_high_water_mark = 0_usize;
+		/// @brief The number of entries that have been queued, but not yet sunk or overwritten
+		u64 consumer_lag = 0_u64;
+
+		/// @brief Returns the number of entries that were lost, ie: dropped or overwritten
+		///
+		/// @return The number of lost entries
+		[[nodiscard]] inline constexpr auto entries_lost() const noexcept -> u64 {
+			return entries_dropped + entries_overwritten;
+		}
+	};
+
+	/// @brief The live counters behind `LoggerStats`, shared by a `Logger`, its message thread,
+	/// and its `SinkWorker`s.
+	///
+	/// The counters incremented by logging threads are `ShardedCounter`s. The rest are only
+	/// written by the thread sinking the entries they count, so they're plain atomics
+	class LoggerStatistics {
+	  public:
+		LoggerStatistics() noexcept = delete;
+		explicit LoggerStatistics(usize num_sinks) noexcept : m_bytes_sunk(num_sinks) {
+		}
+		LoggerStatistics(const LoggerStatistics& statistics) = delete;
+		LoggerStatistics(LoggerStatistics&& statistics) = delete;
+		~LoggerStatistics() noexcept = default;
+
+		/// @brief Records that an entry was queued
+		inline auto record_enqueued() noexcept -> void {
+			m_enqueued.add();
+		}
+
+		/// @brief Records that an entry was rejected because the queue was full
+		inline auto record_dropped() noexcept -> void {
+			m_dropped.add();
+		}
+
+		/// @brief Records that a queued entry was discarded to make room for a newer one
+		inline auto record_overwritten() noexcept -> void {
+			m_overwritten.add();
+		}
+
+		/// @brief Records that `count` entries were sunk. Must only be called from the message
+		/// thread
+		///
+		/// @param count - The number of entries sunk
+		inline auto record_sunk(usize count) noexcept -> void {
+			// release, so a snapshot that sees these entries sunk also sees the bytes they added
+			m_sunk.store(m_sunk.load(std::memory_order_relaxed) + count, std::memory_order_release);
+		}
+
+		/// @brief Records that the message thread found `size` entries in a queue it's about to
+		/// drain. Must only be called from the message thread
+		///
+		/// @param size - The number of entries in the queue
+		inline auto record_queue_size(usize size) noexcept -> void {
+			if(size > m_high_water_mark.load(std::memory_order_relaxed)) {
+				m_high_water_mark.store(size, std::memory_order_relaxed);
+			}
+		}
+
+		/// @brief Returns the counter of bytes sunk to the `Sink` at `index`. Must only be
+		/// incremented from the thread sinking to that `Sink`
+		///
+		/// @param index - The index of the `Sink`
+		///
+		/// @return The counter for the `Sink`
+		[[nodiscard]] inline auto bytes_sunk(usize index) noexcept -> std::atomic<u64>& {
+			return m_bytes_sunk[index];
+		}
+
+		/// @brief Returns a snapshot of the counters
+		///
+		/// @return The snapshot
+		[[nodiscard]] inline auto snapshot() const noexcept -> LoggerStats {
+			auto stats = LoggerStats();
+			// read in the reverse order they're incremented in, so the lag can't underflow
+			stats.entries_sunk = m_sunk.load(std::memory_order_acquire);
+			stats.entries_overwritten = m_overwritten.load();
+			stats.entries_dropped = m_dropped.load();
+			stats.entries_enqueued = m_enqueued.load();
+			stats.queue_high_water_mark = m_high_water_mark.load(std::memory_order_relaxed);
+			stats.bytes_sunk.reserve(m_bytes_sunk.size());
+			for(const auto& bytes : m_bytes_sunk) {
+				stats.bytes_sunk.push_back(bytes.load(std::memory_order_relaxed));
+			}
+
+			const auto settled = stats.entries_sunk + stats.entries_overwritten;
+			stats.consumer_lag
+				= stats.entries_enqueued > settled ? stats.entries_enqueued - settled : 0_u64;
+			return stats;
+		}
+
+		auto operator=(const LoggerStatistics& statistics) -> LoggerStatistics& = delete;
+		auto operator=(LoggerStatistics&& statistics) -> LoggerStatistics& = delete;
+
+	  private:
+		ShardedCounter m_enqueued = ShardedCounter();
+		ShardedCounter m_dropped = ShardedCounter();
+		ShardedCounter m_overwritten = ShardedCounter();
+		std::atomic<u64> m_sunk = 0_u64;
+		std::atomic<usize> m_high_water_mark = 0_usize;
+		std::vector<std::atomic<u64>> m_bytes_sunk;
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
@@ -0,0 +1,151 @@
+/// @brief Registry of per-thread logging queues, used by `Logger`s configured with
+/// `LogBuffering::PerThread`
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../BasicTypes.h"
+#include "../Macros.h"
+#include "../synchronization/EventCount.h"
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	/// @brief Hands each producer thread its own `Queue` and tracks them for the single consumer
+	/// thread draining them.
+	///
+	/// A thread's queue is created and registered the first time it calls `local_buffer`, and
+	/// is cached in thread-local storage after that, so the only shared state producers touch in
+	/// the common case is their own queue. The consumer collects newly registered queues with
+	/// `collect_registered` and drops the queues of threads that have exited with `prune`.
+	///
+	/// @tparam Queue - The single-producer queue type to give each thread
+	template<typename Queue>
+	class ThreadBufferRegistry {
+	  public:
+		using buffer_type = std::shared_ptr<Queue>;
+
+		ThreadBufferRegistry() noexcept = default;
+		ThreadBufferRegistry(const ThreadBufferRegistry& registry) = delete;
+		ThreadBufferRegistry(ThreadBufferRegistry&& registry) = delete;
+		~ThreadBufferRegistry() noexcept = default;
+
+		/// @brief Returns the calling thread's queue, creating and registering it if this is the
+		/// first time the calling thread has used this registry
+		///
+		/// @return The calling thread's queue
+		[[nodiscard]] inline auto local_buffer() noexcept -> Queue& {
+			thread_local auto buffers = std::vector<std::pair<u64, buffer_type>>();
+
+			// the most recently used registry is always at the front
+			if(!buffers.empty() && buffers.front().first == m_id) [[likely]] {
+				return *buffers.front().second;
+			}
+
+			auto found = std::find_if(buffers.begin(), buffers.end(), [this](const auto& buffer) {
+				return buffer.first == m_id;
+			});
+			if(found == buffers.end()) {
+				// queues only referenced from here belong to registries (and consumers) that
+				// no longer exist
+				std::erase_if(buffers,
+							  [](const auto& buffer) { return buffer.second.use_count() == 1; });
+				buffers.emplace_back(m_id, register_buffer());
+				found = std::prev(buffers.end());
+			}
+
+			std::iter_swap(buffers.begin(), found);
+			return *buffers.front().second;
+		}
+
+		/// @brief Wakes the consumer if it is waiting for entries.
+		/// Must be called after pushing to the calling thread's queue
+		inline auto notify_consumer() noexcept -> void {
+			m_pushed.notify_all();
+		}
+
+		/// @brief Moves any newly registered queues into `buffers`.
+		/// Must only be called from the consumer thread
+		///
+		/// @param buffers - The consumer's list of queues
+		inline auto collect_registered(std::vector<buffer_type>& buffers) noexcept -> void {
+			if(!m_has_registered.load(std::memory_order_acquire)) {
+				return;
+			}
+
+			auto lock = std::scoped_lock(m_mutex);
+			std::move(m_registered.begin(), m_registered.end(), std::back_inserter(buffers));
+			m_registered.clear();
+			m_has_registered.store(false, std::memory_order_relaxed);
+		}
+
+		/// @brief Blocks until a queue in `buffers` has entries, a new queue is registered,
+		/// `stop` is requested, or `timeout` elapses. Must only be called from the consumer thread
+		///
+		/// @param buffers - The consumer's list of queues
+		/// @param stop - The stop token to also wake up on
+		/// @param timeout - The longest to wait for
+		template<typename Rep, typename Period>
+		inline auto wait_for_entries(const std::vector<buffer_type>& buffers,
+									 const std::stop_token& stop,
+									 std::chrono::duration<Rep, Period> timeout) noexcept -> void {
+			const auto has_entries = [](const buffer_type& buffer) { return !buffer->empty(); };
+			std::ignore = m_pushed.wait_for(
+				[&]() {
+					return m_has_registered.load(std::memory_order_acquire)
+						   || std::any_of(buffers.begin(), buffers.end(), has_entries);
+				},
+				stop,
+				timeout);
+		}
+
+		/// @brief Removes the queues of threads that have exited, once they have been drained
+		///
+		/// @param buffers - The consumer's list of queues
+		static inline auto prune(std::vector<buffer_type>& buffers) noexcept -> void {
+			std::erase_if(buffers, [](const buffer_type& buffer) {
+				if(buffer.use_count() != 1) {
+					return false;
+				}
+
+				// synchronize with the exiting thread's release of its reference, so its final
+				// entries are visible to `empty`
+				std::atomic_thread_fence(std::memory_order_acquire);
+				return buffer->empty();
+			});
+		}
+
+		auto operator=(const ThreadBufferRegistry& registry) -> ThreadBufferRegistry& = delete;
+		auto operator=(ThreadBufferRegistry&& registry) -> ThreadBufferRegistry& = delete;
+
+	  private:
+		static inline std::atomic<u64> s_next_id = 0_u64; // NOLINT
+
+		u64 m_id = s_next_id.fetch_add(1_u64, std::memory_order_relaxed);
+		std::mutex m_mutex = std::mutex();
+		std::vector<buffer_type> m_registered = std::vector<buffer_type>();
+		std::atomic<bool> m_has_registered = false;
+		utils::EventCount m_pushed = utils::EventCount();
+
+		[[nodiscard]] inline auto register_buffer() noexcept -> buffer_type {
+			auto buffer = std::make_shared<Queue>();
+			{
+				auto lock = std::scoped_lock(m_mutex);
+				m_registered.push_back(buffer);
+				m_has_registered.store(true, std::memory_order_release);
+			}
+			notify_consumer();
+			return buffer;
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
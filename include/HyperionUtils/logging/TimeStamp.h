@@ -0,0 +1,256 @@
+/// @brief Cached rendering of the time stamps prepended to log entries
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <string_view>
+#include <type_traits>
+
+#include "../BasicTypes.h"
+#include "../Macros.h"
+#include "Config.h"
+#include "fmtIncludes.h"
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	/// @brief A rendered time stamp, in the format [Year-Month-Day|Hour-Minute-Second], with the
+	/// fractional seconds appended after a '.' when rendered with sub-second precision
+	class TimeStamp {
+	  public:
+		/// @brief The length of a time stamp rendered with `LogTimeStampPrecision::Seconds`
+		static constexpr usize SECONDS_LENGTH = 21_usize;
+		/// @brief The maximum length of a rendered time stamp
+		static constexpr usize CAPACITY = 32_usize;
+
+		TimeStamp() noexcept = default;
+		TimeStamp(const TimeStamp& stamp) noexcept = default;
+		TimeStamp(TimeStamp&& stamp) noexcept = default;
+		~TimeStamp() noexcept = default;
+
+		/// @brief Returns a view of the rendered time stamp
+		///
+		/// @return The rendered time stamp
+		[[nodiscard]] inline auto view() const noexcept -> std::string_view {
+			return {m_data.data(), m_size};
+		}
+
+		auto operator=(const TimeStamp& stamp) noexcept -> TimeStamp& = default;
+		auto operator=(TimeStamp&& stamp) noexcept -> TimeStamp& = default;
+
+	  private:
+		std::array<char, CAPACITY> m_data = {};
+		usize m_size = 0_usize;
+
+		friend class TimeStampCache;
+	};
+
+	/// @brief Process-wide cache of the rendered time stamp for the current second.
+	///
+	/// Rendering a time stamp requires `localtime` and a `fmt::format` call, which is
+	/// comparatively expensive to do for every log entry. Instead, the rendered
+	/// [Year-Month-Day|Hour-Minute-Second] prefix is cached and only re-rendered when the second
+	/// rolls over, and any sub-second precision is appended to a copy of the cached prefix.
+	///
+	/// The cache is published through a seqlock, so readers never block or take a lock. When the
+	/// second rolls over, the first thread to notice re-renders and publishes the new prefix;
+	/// threads racing it render their own copy without publishing it.
+	class TimeStampCache {
+	  public:
+		TimeStampCache() noexcept = default;
+		TimeStampCache(const TimeStampCache& cache) = delete;
+		TimeStampCache(TimeStampCache&& cache) = delete;
+		~TimeStampCache() noexcept = default;
+
+		/// @brief Returns the process-wide `TimeStampCache`
+		///
+		/// @return The global cache
+		[[nodiscard]] inline static auto instance() noexcept -> TimeStampCache& {
+			HYPERION_NO_DESTROY static TimeStampCache CACHE{};
+			return CACHE;
+		}
+
+		/// @brief Returns the time stamp for the current local time.
+		///
+		/// The fractional seconds are measured with `std::chrono::steady_clock` relative to the
+		/// start of the cached second, so while the second hasn't rolled over this only costs a
+		/// monotonic clock read and a copy of the cached prefix
+		///
+		/// @tparam Precision - The precision to render the time stamp with
+		///
+		/// @return The current time stamp
+		template<LogTimeStampPrecision Precision = LogTimeStampPrecision::Seconds>
+		[[nodiscard]] inline auto now() noexcept -> TimeStamp {
+			const auto steady_now = std::chrono::steady_clock::now();
+			auto stamp = TimeStamp();
+			auto cached = Snapshot();
+
+			if(read(cached) && steady_now >= cached.second_start
+			   && steady_now - cached.second_start < std::chrono::seconds(1))
+			{
+				stamp.m_data = cached.prefix;
+				stamp.m_size = TimeStamp::SECONDS_LENGTH;
+				append_fraction<Precision>(stamp, steady_now - cached.second_start);
+				return stamp;
+			}
+
+			const auto system_now = std::chrono::system_clock::now();
+			const auto second = std::chrono::floor<std::chrono::seconds>(system_now);
+			const auto fraction = system_now - second;
+			const auto second_start
+				= steady_now
+				  - std::chrono::duration_cast<std::chrono::steady_clock::duration>(fraction);
+
+			cached.second = std::chrono::system_clock::to_time_t(second);
+			cached.second_start = second_start;
+			render(cached.prefix, cached.second);
+			publish(cached);
+
+			stamp.m_data = cached.prefix;
+			stamp.m_size = TimeStamp::SECONDS_LENGTH;
+			append_fraction<Precision>(stamp, fraction);
+			return stamp;
+		}
+
+		/// @brief Returns the time stamp for the given time
+		///
+		/// @tparam Precision - The precision to render the time stamp with
+		/// @param time - The time to render the time stamp for
+		///
+		/// @return The time stamp for `time`
+		template<LogTimeStampPrecision Precision = LogTimeStampPrecision::Seconds>
+		[[nodiscard]] inline auto
+		time_stamp(std::chrono::system_clock::time_point time) noexcept -> TimeStamp {
+			const auto second = std::chrono::floor<std::chrono::seconds>(time);
+			auto stamp = time_stamp(std::chrono::system_clock::to_time_t(second));
+			append_fraction<Precision>(stamp, time - second);
+			return stamp;
+		}
+
+		/// @brief Returns the time stamp for the given time, with `LogTimeStampPrecision::Seconds`
+		///
+		/// @param time - The time to render the time stamp for
+		///
+		/// @return The time stamp for `time`
+		[[nodiscard]] inline auto time_stamp(std::time_t time) noexcept -> TimeStamp {
+			auto stamp = TimeStamp();
+			stamp.m_size = TimeStamp::SECONDS_LENGTH;
+
+			auto cached = Snapshot();
+			if(read(cached) && cached.second == time) {
+				stamp.m_data = cached.prefix;
+				return stamp;
+			}
+
+			render(stamp.m_data, time);
+			return stamp;
+		}
+
+		auto operator=(const TimeStampCache& cache) -> TimeStampCache& = delete;
+		auto operator=(TimeStampCache&& cache) -> TimeStampCache& = delete;
+
+	  private:
+		static constexpr usize NUM_PREFIX_WORDS = TimeStamp::CAPACITY / sizeof(u64);
+
+		struct Snapshot {
+			std::time_t second = 0;
+			std::chrono::steady_clock::time_point second_start
+				= std::chrono::steady_clock::time_point();
+			std::array<char, TimeStamp::CAPACITY> prefix = {};
+		};
+
+		// the prefix is stored in atomic words so that racing reads of it are well-defined
+		// (and then discarded by the sequence check)
+		std::atomic<u64> m_sequence = 0_u64;
+		std::atomic<std::time_t> m_second = -1;
+		std::atomic<std::chrono::steady_clock::rep> m_second_start = 0;
+		std::array<std::atomic<u64>, NUM_PREFIX_WORDS> m_prefix = {};
+
+		/// @brief Reads the cached time stamp into `snapshot`
+		///
+		/// @return Whether a consistent snapshot could be read
+		[[nodiscard]] inline auto read(Snapshot& snapshot) const noexcept -> bool {
+			const auto sequence = m_sequence.load(std::memory_order_acquire);
+			if((sequence & 1_u64) != 0_u64) {
+				return false;
+			}
+
+			snapshot.second = m_second.load(std::memory_order_relaxed);
+			snapshot.second_start = std::chrono::steady_clock::time_point(
+				std::chrono::steady_clock::duration(m_second_start.load(std::memory_order_relaxed)));
+			auto words = std::array<u64, NUM_PREFIX_WORDS>();
+			for(auto i = 0_usize; i < NUM_PREFIX_WORDS; ++i) {
+				words[i] = m_prefix[i].load(std::memory_order_relaxed); // NOLINT
+			}
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if(m_sequence.load(std::memory_order_relaxed) != sequence) {
+				return false;
+			}
+
+			std::memcpy(snapshot.prefix.data(), words.data(), sizeof(words));
+			return true;
+		}
+
+		/// @brief Publishes `snapshot` as the cached time stamp, unless another thread is
+		/// already publishing one
+		inline auto publish(const Snapshot& snapshot) noexcept -> void {
+			auto sequence = m_sequence.load(std::memory_order_relaxed);
+			if((sequence & 1_u64) != 0_u64
+			   || !m_sequence.compare_exchange_strong(sequence,
+													  sequence + 1_u64,
+													  std::memory_order_relaxed))
+			{
+				return;
+			}
+			std::atomic_thread_fence(std::memory_order_release);
+
+			auto words = std::array<u64, NUM_PREFIX_WORDS>();
+			std::memcpy(words.data(), snapshot.prefix.data(), sizeof(words));
+			m_second.store(snapshot.second, std::memory_order_relaxed);
+			m_second_start.store(snapshot.second_start.time_since_epoch().count(),
+								 std::memory_order_relaxed);
+			for(auto i = 0_usize; i < NUM_PREFIX_WORDS; ++i) {
+				m_prefix[i].store(words[i], std::memory_order_relaxed); // NOLINT
+			}
+
+			m_sequence.store(sequence + 2_u64, std::memory_order_release);
+		}
+
+		/// @brief Renders the [Year-Month-Day|Hour-Minute-Second] time stamp for `time` into
+		/// `data`
+		inline static auto
+		render(std::array<char, TimeStamp::CAPACITY>& data, std::time_t time) noexcept -> void {
+			fmt::format_to_n(data.data(),
+							 TimeStamp::SECONDS_LENGTH,
+							 "[{:%Y-%m-%d|%H-%M-%S}]",
+							 fmt::localtime(time));
+		}
+
+		/// @brief Appends the fractional seconds in `fraction` to `stamp`, as specified by
+		/// `Precision`
+		template<LogTimeStampPrecision Precision, typename Duration>
+		inline static auto append_fraction(TimeStamp& stamp, Duration fraction) noexcept -> void {
+			if constexpr(Precision != LogTimeStampPrecision::Seconds) {
+				using unit = std::conditional_t<Precision == LogTimeStampPrecision::Milliseconds,
+												std::chrono::milliseconds,
+												std::chrono::microseconds>;
+				constexpr auto digits = Precision == LogTimeStampPrecision::Milliseconds ? 3 : 6;
+
+				// replace the closing ']' with ".<fraction>]"
+				const auto count = std::chrono::duration_cast<unit>(fraction).count();
+				auto* const begin = stamp.m_data.data() + stamp.m_size - 1_usize; // NOLINT
+				const auto result = fmt::format_to_n(begin,
+													 TimeStamp::CAPACITY - stamp.m_size + 1_usize,
+													 ".{:0{}}]",
+													 count,
+													 digits);
+				stamp.m_size += static_cast<usize>(result.size) - 1_usize;
+			}
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
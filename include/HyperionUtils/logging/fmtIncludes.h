@@ -15,6 +15,11 @@ IGNORE_COMMA_MISUSE_START
 #include <fmt/format.h>
 #include <fmt/os.h>
 
+// `dynamic_format_arg_store` moved out of fmt/core.h in fmt 8
+#if __has_include(<fmt/args.h>)
+	#include <fmt/args.h>
+#endif
+
 IGNORE_COMMA_MISUSE_STOP
 IGNORE_CONSTRUCTOR_SHADOW_FIELDS_STOP
 IGNORE_WEAK_VTABLES_STOP
@@ -1,6 +1,8 @@
 /// @brief `Option` represents an optional value
 #pragma once
 
+#include <memory>
+
 #include "../Concepts.h"
 #include "../Error.h"
 #include "../Ignore.h"
@@ -52,25 +54,18 @@ namespace hyperion {
 			ignore(none);
 		}
 		/// @brief Copy Constructor
-		constexpr Option(const Option& option) noexcept requires CopyAssignable<T> {
+		constexpr Option(const Option& option) noexcept requires CopyConstructible<T> {
 			if(option.m_is_some) {
-				m_data.m_some = option.m_data.m_some;
+				std::construct_at(std::addressof(m_data.m_some), option.m_data.m_some);
 				m_is_some = true;
 			}
 		}
 		/// @brief Move Constructor
-		constexpr Option(Option&& option) noexcept requires MoveAssignable<T> {
-			this->m_is_some = option.m_is_some;
+		constexpr Option(Option&& option) noexcept requires MoveConstructible<T> {
 			if(option.m_is_some) {
-				option.m_is_some = false;
-				if constexpr(Pointer<T>) {
-					m_data.m_some = option.m_data.m_some;
-					option.m_data.m_none = 0;
-				}
-				else if constexpr(MoveConstructible<T>) {
-					m_data.m_some = std::move(option.m_data.m_some);
-					option.m_data.m_none = 0;
-				}
+				std::construct_at(std::addressof(m_data.m_some), std::move(option.m_data.m_some));
+				m_is_some = true;
+				option.reset();
 			}
 		}
 
@@ -400,13 +395,15 @@ namespace hyperion {
 		/// @return The contained `T`
 		[[nodiscard]] constexpr inline auto unwrap() noexcept -> T {
 			if(m_is_some) {
-				m_is_some = false;
-				if constexpr(Pointer<T>) {
-					auto* some = m_data.m_some;
-					m_data.m_some = nullptr;
-					return some;
-				}
-				else if constexpr(CopyConstructible<T> && !MoveConstructible<T>) {
+				// the contained value is destroyed once the returned one is constructed from it
+				struct Reset {
+					Option& option; // NOLINT
+					constexpr ~Reset() noexcept {
+						option.reset();
+					}
+				};
+				const auto reset_on_return = Reset{*this};
+				if constexpr(CopyConstructible<T> && !MoveConstructible<T>) {
 					return m_data.m_some;
 				}
 				else {
@@ -542,35 +539,45 @@ namespace hyperion {
 		}
 
 		/// @brief Copy assignment operator
-		constexpr auto operator=(const Option& option) -> Option& requires CopyAssignable<T> {
+		constexpr auto operator=(const Option& option)
+			-> Option& requires CopyConstructible<T> && CopyAssignable<T> {
 			if(this == &option) {
 				return *this;
 			}
 
-			if(option.m_is_some) {
-				m_is_some = true;
+			if(!option.m_is_some) {
+				reset();
+			}
+			else if(m_is_some) {
 				m_data.m_some = option.m_data.m_some;
 			}
 			else {
-				m_is_some = false;
-				m_data.m_none = 0;
+				std::construct_at(std::addressof(m_data.m_some), option.m_data.m_some);
+				m_is_some = true;
 			}
 
 			return *this;
 		}
 		/// @brief Move assignment operator
-		constexpr auto operator=(Option&& option) noexcept -> Option& requires MoveAssignable<T> {
-			this->m_is_some = option.m_is_some;
-			if(option.m_is_some) {
-				option.m_is_some = false;
-				if constexpr(Pointer<T>) {
-					m_data.m_some = option.m_data.m_some;
-					option.m_data.m_none = 0;
-				}
-				else if constexpr(MoveConstructible<T>) {
+		constexpr auto operator=(Option&& option) noexcept
+			-> Option& requires MoveConstructible<T> && MoveAssignable<T> {
+			if(this == &option) {
+				return *this;
+			}
+
+			if(!option.m_is_some) {
+				reset();
+			}
+			else {
+				if(m_is_some) {
 					m_data.m_some = std::move(option.m_data.m_some);
-					option.m_data.m_none = 0;
 				}
+				else {
+					std::construct_at(std::addressof(m_data.m_some),
+									  std::move(option.m_data.m_some));
+					m_is_some = true;
+				}
+				option.reset();
 			}
 			return *this;
 		}
@@ -601,6 +608,9 @@ namespace hyperion {
 			T m_some;
 			int m_none = 0;
 
+			/// `None`, so no `T` is constructed
+			constexpr Data() noexcept { // NOLINT
+			}
 			explicit constexpr Data(const T& some) noexcept requires CopyConstructible<T>
 				: m_some(some) {
 			}
@@ -617,6 +627,15 @@ namespace hyperion {
 
 		/// Whether this is `Some`
 		bool m_is_some = false;
+
+		/// @brief Destroys the contained value, if any, making this `None`
+		constexpr inline auto reset() noexcept -> void {
+			if(m_is_some) {
+				std::destroy_at(std::addressof(m_data.m_some));
+				m_data.m_none = 0;
+				m_is_some = false;
+			}
+		}
 	};
 	IGNORE_PADDING_STOP
 
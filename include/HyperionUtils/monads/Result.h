@@ -1,6 +1,8 @@
 /// @brief `Result` represents the outcome of an operation that can fail recoverably
 #pragma once
 
+#include <memory>
+
 #include "../Concepts.h"
 #include "../Error.h"
 #include "../Ignore.h"
@@ -50,38 +52,9 @@ namespace hyperion {
 		constexpr Result(const Result& result) = delete;
 		/// @brief Move Constructor
 		/// Moving a `Result` consumes it, leaving a disengaged (valueless) `Result` in its place
-		constexpr Result(Result&& result) noexcept requires MoveAssignable<T> && MoveAssignable<E> {
-			this->m_handled = result.m_handled;
-			result.m_handled = true;
-			this->m_is_ok = result.m_is_ok;
-			if(result.m_engaged) {
-				if(result.m_is_ok) {
-					result.m_is_ok = false;
-					if constexpr(Pointer<T>) {
-						result.m_engaged = false;
-						m_data.m_ok = result.m_data.m_ok;
-						result.m_data.m_ok = nullptr;
-					}
-					else {
-						// we don't actually disengage in the non-pointer case, so that the
-						// destructor of the moved from `ok` can be run
-						m_data.m_ok = std::move(result.m_data.m_ok);
-					}
-				}
-				else {
-					if constexpr(Pointer<E>) {
-						result.m_engaged = false;
-						m_data.m_err = result.m_data.m_err;
-						result.m_data.m_err = nullptr;
-					}
-					else {
-						// we don't actually disengage in the non-pointer case, so that the
-						// destructor of the moved from `ok` can be run
-						m_data.m_err = std::move(result.m_data.m_err);
-					}
-				}
-				m_engaged = true;
-			}
+		constexpr Result(Result&& result) noexcept
+			requires MoveConstructible<T> && MoveConstructible<E> {
+			take(result);
 		}
 		/// @brief Constructs a `Result` from an `Err`
 		///
@@ -110,28 +83,7 @@ namespace hyperion {
 
 		/// @brief Destructor
 		~Result() noexcept { // NOLINT
-			if(m_engaged) {
-				if(m_is_ok) {
-					if constexpr(Pointer<T>) {
-						m_data.m_ok = nullptr;
-					}
-					else {
-						if(Destructible<T>) {
-							m_data.m_ok.~T();
-						}
-					}
-				}
-				else {
-					if constexpr(Pointer<E>) {
-						m_data.m_err = nullptr;
-					}
-					else {
-						if(Destructible<E>) {
-							m_data.m_err.~E();
-						}
-					}
-				}
-			}
+			destroy();
 			if(!m_handled) {
 				fmt::print(stderr,
 						   "Unhandled Result that must be handled being destroyed, terminating\n");
@@ -305,8 +257,8 @@ namespace hyperion {
 		[[nodiscard]] constexpr inline auto unwrap() noexcept -> T {
 			m_handled = true;
 			if(m_is_ok) {
-				m_is_ok = false;
-				m_engaged = false;
+				// the contained value is destroyed once the returned one is constructed from it
+				const auto destroy_on_return = Destroy{*this};
 				if constexpr(Pointer<T>) {
 					auto _ok = m_data.m_ok;
 					m_data.m_ok = nullptr;
@@ -386,7 +338,8 @@ namespace hyperion {
 		[[nodiscard]] constexpr inline auto unwrap_err() noexcept -> E {
 			m_handled = true;
 			if(!m_is_ok) {
-				m_engaged = false;
+				// the contained value is destroyed once the returned one is constructed from it
+				const auto destroy_on_return = Destroy{*this};
 				if constexpr(Pointer<E>) {
 					auto* _err = m_data.m_err;
 					m_data.m_err = nullptr;
@@ -413,8 +366,8 @@ namespace hyperion {
 		[[nodiscard]] constexpr inline auto ok() noexcept -> Option<T> {
 			m_handled = true;
 			if(m_is_ok) {
-				m_is_ok = false;
-				m_engaged = false;
+				// the contained value is destroyed once the returned one is constructed from it
+				const auto destroy_on_return = Destroy{*this};
 				if constexpr(Pointer<T>) {
 					auto* _ok = m_data.m_ok;
 					m_data.m_ok = nullptr;
@@ -439,7 +392,8 @@ namespace hyperion {
 		[[nodiscard]] constexpr inline auto err() noexcept -> Option<E> {
 			m_handled = true;
 			if(!m_is_ok) {
-				m_engaged = false;
+				// the contained value is destroyed once the returned one is constructed from it
+				const auto destroy_on_return = Destroy{*this};
 				if constexpr(Pointer<E>) {
 					auto* _err = m_data.m_err;
 					m_data.m_err = nullptr;
@@ -667,38 +621,13 @@ namespace hyperion {
 		/// @brief Move assignment operator.
 		/// Moving a `Result` consumes it, leaving a disengaged (valueless) `Result` in its place
 		constexpr auto operator=(Result&& result) noexcept
-			-> Result& requires MoveAssignable<T> && MoveAssignable<E> {
-			this->m_handled = result.m_handled;
-			result.m_handled = true;
-			this->m_is_ok = result.m_is_ok;
-			if(result.m_engaged) {
-				if(result.m_is_ok) {
-					result.m_is_ok = false;
-					if constexpr(Pointer<T>) {
-						result.m_engaged = false;
-						m_data.m_ok = result.m_data.m_ok;
-						result.m_data.m_ok = nullptr;
-					}
-					else {
-						// we don't actually disengage in the non-pointer case, so that the
-						// destructor of the moved from `ok` can be run
-						m_data.m_ok = std::move(result.m_data.m_ok);
-					}
-				}
-				else {
-					if constexpr(Pointer<E>) {
-						result.m_engaged = false;
-						m_data.m_err = result.m_data.m_err;
-						result.m_data.m_err = nullptr;
-					}
-					else {
-						// we don't actually disengage in the non-pointer case, so that the
-						// destructor of the moved from `ok` can be run
-						m_data.m_err = std::move(result.m_data.m_err);
-					}
-				}
-				m_engaged = true;
+			-> Result& requires MoveConstructible<T> && MoveConstructible<E> {
+			if(this == &result) {
+				return *this;
 			}
+
+			destroy();
+			take(result);
 			return *this;
 		}
 
@@ -727,6 +656,9 @@ namespace hyperion {
 			E m_err;
 			int m_disengaged = 0;
 
+			/// Valueless, so neither a `T` nor an `E` is constructed
+			constexpr Data() noexcept { // NOLINT
+			}
 			explicit constexpr Data(const T& ok) noexcept requires CopyConstructible<T> : m_ok(ok) {
 			}
 			explicit constexpr Data(T&& ok) noexcept requires MoveConstructible<T>
@@ -756,6 +688,53 @@ namespace hyperion {
 		bool m_engaged = false;
 		/// whether this `Result` has been handled
 		mutable bool m_handled = false;
+
+		/// @brief Destroys the contained value, if any, leaving this valueless
+		constexpr inline auto destroy() noexcept -> void {
+			if(m_engaged) {
+				if(m_is_ok) {
+					std::destroy_at(std::addressof(m_data.m_ok));
+				}
+				else {
+					std::destroy_at(std::addressof(m_data.m_err));
+				}
+				m_data.m_disengaged = 0;
+				m_engaged = false;
+			}
+		}
+
+		/// @brief Destroys the contained value of `result`, if any, when it goes out of scope.
+		/// Held by the consuming operations while they return the value they move out of `result`
+		struct Destroy {
+			Result& result; // NOLINT
+
+			constexpr ~Destroy() noexcept {
+				result.destroy();
+				result.m_is_ok = false;
+			}
+		};
+
+		/// @brief Moves the contents of `result` into this, which must be valueless, consuming
+		/// `result` and leaving it valueless
+		///
+		/// @param result - The `Result` to move from
+		constexpr inline auto take(Result& result) noexcept -> void {
+			m_handled = result.m_handled;
+			result.m_handled = true;
+			m_is_ok = result.m_is_ok;
+			if(result.m_engaged) {
+				if(result.m_is_ok) {
+					std::construct_at(std::addressof(m_data.m_ok), std::move(result.m_data.m_ok));
+				}
+				else {
+					std::construct_at(std::addressof(m_data.m_err),
+									  std::move(result.m_data.m_err));
+				}
+				m_engaged = true;
+				result.destroy();
+			}
+			result.m_is_ok = false;
+		}
 	};
 	IGNORE_PADDING_STOP
 
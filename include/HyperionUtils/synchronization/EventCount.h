@@ -0,0 +1,195 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include "../BasicTypes.h"
+#include "../Macros.h"
+
+namespace hyperion::utils {
+	IGNORE_PADDING_START
+	/// @brief Lets threads block until a condition on some lock-free state becomes true, without
+	/// adding a lock to the fast path of the threads making it true.
+	///
+	/// Waiting threads wait adaptively: they first spin re-checking the condition, then yield
+	/// their time slice, and finally park on an `std::atomic::wait` (a futex on Linux).
+	/// Notifying threads only pay for a fence and a load unless another thread is actually
+	/// parked, in which case they also bump the epoch and wake it. `std::atomic::wait` can't
+	/// time out, so threads waiting with a timeout park on a condition variable instead, which
+	/// notifying threads only lock when such a thread is parked.
+	///
+	/// Copying or moving an `EventCount` doesn't copy any waiters; the new `EventCount` starts
+	/// with none
+	class EventCount {
+	  public:
+		EventCount() noexcept = default;
+		EventCount([[maybe_unused]] const EventCount& event) noexcept {
+		}
+		EventCount([[maybe_unused]] EventCount&& event) noexcept {
+		}
+		~EventCount() noexcept = default;
+
+		/// @brief Wakes all threads parked in `wait_until`, if there are any.
+		/// Must be called after making the state a waiter could be waiting on visible
+		inline auto notify_all() noexcept -> void {
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if(m_num_waiters.load(std::memory_order_relaxed) != 0_u32) {
+				m_epoch.fetch_add(1_u32, std::memory_order_release);
+				m_epoch.notify_all();
+			}
+			if(m_num_timed_waiters.load(std::memory_order_relaxed) != 0_u32) {
+				// a timed waiter holds the mutex from checking its condition until it's parked,
+				// so taking it here means it can't miss this notification
+				{
+					auto lock = std::lock_guard(m_mutex);
+				}
+				m_timed_waiters.notify_all();
+			}
+		}
+
+		/// @brief Blocks the calling thread until `condition` returns `true`
+		///
+		/// @param condition - The condition to wait for
+		template<typename Condition>
+		inline auto wait_until(Condition&& condition) noexcept -> void {
+			if(spin_until(condition)) {
+				return;
+			}
+
+			while(!park_until(condition)) {
+			}
+		}
+
+		/// @brief Blocks the calling thread until `condition` returns `true` or `stop` is
+		/// requested
+		///
+		/// @param condition - The condition to wait for
+		/// @param stop - The stop token to also wake up on
+		template<typename Condition>
+		inline auto wait_until(Condition&& condition, const std::stop_token& stop) noexcept
+			-> void {
+			const auto condition_or_stop
+				= [&condition, &stop]() { return stop.stop_requested() || condition(); };
+			if(spin_until(condition_or_stop)) {
+				return;
+			}
+
+			auto callback = std::stop_callback(stop, [this]() { notify_all(); });
+			while(!park_until(condition_or_stop)) {
+			}
+		}
+
+		/// @brief Blocks the calling thread until `condition` returns `true` or `timeout` elapses
+		///
+		/// @param condition - The condition to wait for
+		/// @param timeout - The longest to wait for
+		///
+		/// @return Whether `condition` became `true` before the timeout
+		template<typename Condition, typename Rep, typename Period>
+		[[nodiscard]] inline auto
+		wait_for(Condition&& condition, std::chrono::duration<Rep, Period> timeout) noexcept
+			-> bool {
+			const auto deadline = std::chrono::steady_clock::now() + timeout;
+			if(spin_until(condition)) {
+				return true;
+			}
+
+			auto lock = std::unique_lock(m_mutex);
+			m_num_timed_waiters.fetch_add(1_u32, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			auto done = condition();
+			while(!done) {
+				if(m_timed_waiters.wait_until(lock, deadline) == std::cv_status::timeout) {
+					done = condition();
+					break;
+				}
+				done = condition();
+			}
+
+			m_num_timed_waiters.fetch_sub(1_u32, std::memory_order_relaxed);
+			return done;
+		}
+
+		/// @brief Blocks the calling thread until `condition` returns `true`, `stop` is
+		/// requested, or `timeout` elapses
+		///
+		/// @param condition - The condition to wait for
+		/// @param stop - The stop token to also wake up on
+		/// @param timeout - The longest to wait for
+		///
+		/// @return Whether `condition` became `true` or `stop` was requested before the timeout
+		template<typename Condition, typename Rep, typename Period>
+		[[nodiscard]] inline auto wait_for(Condition&& condition,
+										   const std::stop_token& stop,
+										   std::chrono::duration<Rep, Period> timeout) noexcept
+			-> bool {
+			const auto condition_or_stop
+				= [&condition, &stop]() { return stop.stop_requested() || condition(); };
+			auto callback = std::stop_callback(stop, [this]() { notify_all(); });
+			return wait_for(condition_or_stop, timeout);
+		}
+
+		auto operator=([[maybe_unused]] const EventCount& event) noexcept -> EventCount& {
+			return *this;
+		}
+		auto operator=([[maybe_unused]] EventCount&& event) noexcept -> EventCount& {
+			return *this;
+		}
+
+	  private:
+		static constexpr u32 NUM_SPINS = 64_u32;
+		static constexpr u32 NUM_YIELDS = 16_u32;
+
+		std::atomic<u32> m_epoch = 0_u32;
+		std::atomic<u32> m_num_waiters = 0_u32;
+		std::atomic<u32> m_num_timed_waiters = 0_u32;
+		std::mutex m_mutex;
+		std::condition_variable m_timed_waiters;
+
+		/// @brief Spins, and then yields, re-checking `condition` in between
+		///
+		/// @return Whether `condition` became `true`
+		template<typename Condition>
+		[[nodiscard]] inline auto spin_until(Condition& condition) noexcept -> bool {
+			for(auto i = 0_u32; i < NUM_SPINS; ++i) {
+				if(condition()) {
+					return true;
+				}
+			}
+
+			for(auto i = 0_u32; i < NUM_YIELDS; ++i) {
+				if(condition()) {
+					return true;
+				}
+				std::this_thread::yield();
+			}
+
+			return false;
+		}
+
+		/// @brief Parks the calling thread until it is notified, unless `condition` is already
+		/// `true` once registered as a waiter
+		///
+		/// @return Whether `condition` was `true`
+		template<typename Condition>
+		[[nodiscard]] inline auto park_until(Condition& condition) noexcept -> bool {
+			const auto epoch = m_epoch.load(std::memory_order_acquire);
+			m_num_waiters.fetch_add(1_u32, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			const auto done = condition();
+			if(!done) {
+				m_epoch.wait(epoch, std::memory_order_acquire);
+			}
+
+			m_num_waiters.fetch_sub(1_u32, std::memory_order_relaxed);
+			return done;
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion::utils
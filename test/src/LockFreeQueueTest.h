@@ -0,0 +1,377 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "HyperionUtils/LockFreeQueue.h"
+
+namespace hyperion::utils::test {
+
+	TEST(LockFreeQueueTest, readIsFifo) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 16>();
+		for(auto i = 0; i < 8; ++i) {
+			ASSERT_TRUE(queue.push(i).is_ok());
+		}
+
+		for(auto i = 0; i < 8; ++i) {
+			ASSERT_EQ(queue.read().unwrap(), i);
+		}
+		ASSERT_TRUE(queue.read().is_err());
+	}
+
+	TEST(LockFreeQueueTest, readN) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 16>();
+		auto entries = std::array<int, 4>();
+		ASSERT_EQ(queue.read_n(Span<int>::make_span(entries.data(), entries.size())), 0_usize);
+
+		for(auto i = 0; i < 10; ++i) {
+			ASSERT_TRUE(queue.push(i).is_ok());
+		}
+
+		auto expected = 0;
+		for(auto num_read = queue.read_n(Span<int>::make_span(entries.data(), entries.size())); num_read != 0_usize;
+			num_read = queue.read_n(Span<int>::make_span(entries.data(), entries.size())))
+		{
+			for(auto i = 0_usize; i < num_read; ++i) {
+				ASSERT_EQ(entries[i], expected++); // NOLINT
+			}
+		}
+		ASSERT_EQ(expected, 10);
+		ASSERT_TRUE(queue.empty());
+	}
+
+	TEST(LockFreeQueueTest, mpmcReadN) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 16, QueueConcurrency::MPMC>();
+		auto entries = std::array<int, 4>();
+		ASSERT_EQ(queue.read_n(Span<int>::make_span(entries.data(), entries.size())), 0_usize);
+
+		for(auto i = 0; i < 10; ++i) {
+			ASSERT_TRUE(queue.push(i).is_ok());
+		}
+
+		auto expected = 0;
+		for(auto num_read = queue.read_n(Span<int>::make_span(entries.data(), entries.size())); num_read != 0_usize;
+			num_read = queue.read_n(Span<int>::make_span(entries.data(), entries.size())))
+		{
+			for(auto i = 0_usize; i < num_read; ++i) {
+				ASSERT_EQ(entries[i], expected++); // NOLINT
+			}
+		}
+		ASSERT_EQ(expected, 10);
+		ASSERT_TRUE(queue.empty());
+	}
+
+	TEST(LockFreeQueueTest, mpmcPushAndRead) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 16, QueueConcurrency::MPMC>();
+		ASSERT_TRUE(queue.empty());
+		ASSERT_TRUE(queue.read().is_err());
+
+		for(auto i = 0; i < 16; ++i) {
+			ASSERT_TRUE(queue.push(i).is_ok());
+		}
+		ASSERT_TRUE(queue.full());
+		ASSERT_TRUE(queue.push(16).is_err());
+		ASSERT_FALSE(queue.try_push(16));
+
+		for(auto i = 0; i < 16; ++i) {
+			ASSERT_EQ(queue.read().unwrap(), i);
+		}
+		ASSERT_TRUE(queue.empty());
+		ASSERT_TRUE(queue.try_pop().is_none());
+	}
+
+	TEST(LockFreeQueueTest, mpmcOverwriteWhenFull) {
+		auto queue
+			= LockFreeQueue<int, QueuePolicy::OverwriteWhenFull, 16, QueueConcurrency::MPMC>();
+
+		for(auto i = 0; i < 24; ++i) {
+			queue.push(i);
+		}
+		ASSERT_EQ(queue.size(), 16_usize);
+
+		for(auto i = 8; i < 24; ++i) {
+			ASSERT_EQ(queue.read().unwrap(), i);
+		}
+		ASSERT_TRUE(queue.empty());
+	}
+
+	TEST(LockFreeQueueTest, mpmcStress) {
+		constexpr auto num_producers = 4_usize;
+		constexpr auto num_consumers = 4_usize;
+		constexpr auto num_per_producer = 20000_usize;
+		constexpr auto producer_shift = 32_usize;
+
+		auto queue = LockFreeQueue<usize, QueuePolicy::ErrWhenFull, 64, QueueConcurrency::MPMC>();
+		auto num_read = std::atomic<usize>(0_usize);
+		auto reads_in_order = std::atomic<bool>(true);
+		auto counts = std::vector<std::atomic<usize>>(num_producers);
+
+		{
+			auto threads = std::vector<std::jthread>();
+			for(auto producer = 0_usize; producer < num_producers; ++producer) {
+				threads.emplace_back([&queue, producer]() {
+					for(auto i = 0_usize; i < num_per_producer; ++i) {
+						while(!queue.try_push((producer << producer_shift) | i)) {
+							std::this_thread::yield();
+						}
+					}
+				});
+			}
+
+			for(auto consumer = 0_usize; consumer < num_consumers; ++consumer) {
+				threads.emplace_back([&]() {
+					// each consumer must observe every producer's entries in the order they were
+					// pushed
+					auto last_seen = std::vector<i64>(num_producers, -1);
+					while(num_read.load() < num_producers * num_per_producer) {
+						if(auto entry = queue.try_pop()) {
+							const auto value = entry.unwrap();
+							const auto producer = value >> producer_shift;
+							const auto index = static_cast<i64>(value & 0xFFFF'FFFFU);
+							if(index <= last_seen[producer]) {
+								reads_in_order.store(false);
+							}
+							last_seen[producer] = index;
+							counts[producer].fetch_add(1_usize);
+							num_read.fetch_add(1_usize);
+						}
+						else {
+							std::this_thread::yield();
+						}
+					}
+				});
+			}
+		}
+
+		ASSERT_TRUE(reads_in_order.load());
+		ASSERT_TRUE(queue.empty());
+		for(auto& count : counts) {
+			ASSERT_EQ(count.load(), num_per_producer);
+		}
+	}
+
+	TEST(LockFreeQueueTest, spscPushAndRead) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 16, QueueConcurrency::SPSC>();
+		ASSERT_TRUE(queue.empty());
+		ASSERT_TRUE(queue.read().is_err());
+
+		for(auto i = 0; i < 16; ++i) {
+			ASSERT_TRUE(queue.push(i).is_ok());
+		}
+		ASSERT_TRUE(queue.full());
+		ASSERT_TRUE(queue.push(16).is_err());
+		ASSERT_FALSE(queue.try_push(16));
+
+		for(auto i = 0; i < 8; ++i) {
+			ASSERT_EQ(queue.read().unwrap(), i);
+		}
+
+		auto entries = std::array<int, 16>();
+		ASSERT_EQ(queue.read_n(Span<int>::make_span(entries.data(), entries.size())), 8_usize);
+		for(auto i = 0_usize; i < 8_usize; ++i) {
+			ASSERT_EQ(entries[i], static_cast<int>(i) + 8); // NOLINT
+		}
+		ASSERT_TRUE(queue.empty());
+		ASSERT_TRUE(queue.try_pop().is_none());
+	}
+
+	/// @brief Counts its live instances, and isn't default constructible
+	struct QueuedEntry {
+		static inline i64 s_num_live = 0; // NOLINT
+
+		explicit QueuedEntry(int val) noexcept : value(val) {
+			++s_num_live;
+		}
+		QueuedEntry(const QueuedEntry& entry) noexcept : value(entry.value) {
+			++s_num_live;
+		}
+		QueuedEntry(QueuedEntry&& entry) noexcept : value(entry.value) {
+			++s_num_live;
+		}
+		~QueuedEntry() noexcept {
+			--s_num_live;
+		}
+
+		auto operator=(const QueuedEntry& entry) noexcept -> QueuedEntry& = default;
+		auto operator=(QueuedEntry&& entry) noexcept -> QueuedEntry& = default;
+
+		int value;
+	};
+
+	template<QueueConcurrency Concurrency>
+	auto check_only_queued_entries_are_constructed() -> void {
+		using Queue = LockFreeQueue<QueuedEntry, QueuePolicy::ErrWhenFull, 8, Concurrency>;
+		QueuedEntry::s_num_live = 0;
+		{
+			auto queue = std::make_unique<Queue>();
+			ASSERT_EQ(QueuedEntry::s_num_live, 0);
+
+			for(auto i = 0; i < 6; ++i) {
+				ASSERT_TRUE(queue->try_emplace(i));
+			}
+			ASSERT_EQ(QueuedEntry::s_num_live, 6);
+
+			ASSERT_EQ(queue->try_pop().unwrap().value, 0);
+			ASSERT_EQ(QueuedEntry::s_num_live, 5);
+
+			auto entries = std::vector<QueuedEntry>(3, QueuedEntry(0));
+			ASSERT_EQ(queue->read_n(Span<QueuedEntry>::make_span(entries.data(), entries.size())),
+					  3_usize);
+			ASSERT_EQ(entries[2].value, 3);
+			ASSERT_EQ(QueuedEntry::s_num_live, 2 + 3);
+		}
+		// the entries still queued are destroyed with the queue
+		ASSERT_EQ(QueuedEntry::s_num_live, 0);
+	}
+
+	TEST(LockFreeQueueTest, onlyQueuedEntriesAreConstructed) {
+		check_only_queued_entries_are_constructed<QueueConcurrency::MPMC>();
+		check_only_queued_entries_are_constructed<QueueConcurrency::SPSC>();
+	}
+
+	TEST(LockFreeQueueTest, spscStress) {
+		constexpr auto num_entries = 100000_usize;
+
+		auto queue = LockFreeQueue<usize, QueuePolicy::ErrWhenFull, 64, QueueConcurrency::SPSC>();
+		auto reads_in_order = true;
+		auto num_read = 0_usize;
+
+		{
+			auto producer = std::jthread([&queue]() {
+				for(auto i = 0_usize; i < num_entries; ++i) {
+					while(!queue.try_push(i)) {
+						std::this_thread::yield();
+					}
+				}
+			});
+
+			auto consumer = std::jthread([&]() {
+				auto entries = std::array<usize, 16>();
+				while(num_read < num_entries) {
+					const auto read
+						= queue.read_n(Span<usize>::make_span(entries.data(), entries.size()));
+					if(read == 0_usize) {
+						std::this_thread::yield();
+					}
+					for(auto i = 0_usize; i < read; ++i) {
+						reads_in_order = reads_in_order && entries[i] == num_read; // NOLINT
+						++num_read;
+					}
+				}
+			});
+		}
+
+		ASSERT_TRUE(reads_in_order);
+		ASSERT_EQ(num_read, num_entries);
+		ASSERT_TRUE(queue.empty());
+	}
+
+	TEST(LockFreeQueueTest, waitForEntriesWakesOnPush) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 16, QueueConcurrency::SPSC>();
+		auto read = 0;
+
+		{
+			auto consumer = std::jthread([&](const std::stop_token& stop) {
+				queue.wait_for_entries(stop);
+				read = queue.read().unwrap();
+			});
+
+			// give the consumer time to park before pushing
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			ASSERT_TRUE(queue.push(4).is_ok());
+			queue.notify_pushed();
+		}
+
+		ASSERT_EQ(read, 4);
+	}
+
+	TEST(LockFreeQueueTest, waitForEntriesWakesOnStop) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 16>();
+		auto woke = std::atomic<bool>(false);
+
+		auto consumer = std::jthread([&](const std::stop_token& stop) {
+			queue.wait_for_entries(stop);
+			woke.store(true);
+		});
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		ASSERT_FALSE(woke.load());
+		consumer.request_stop();
+		consumer.join();
+		ASSERT_TRUE(woke.load());
+	}
+
+	TEST(LockFreeQueueTest, waitForSpaceWakesOnRead) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 4, QueueConcurrency::MPMC>();
+		for(auto i = 0; i < 4; ++i) {
+			ASSERT_TRUE(queue.push(i).is_ok());
+		}
+
+		{
+			auto producer = std::jthread([&queue]() {
+				queue.wait_for_space();
+				ASSERT_TRUE(queue.push(4).is_ok());
+			});
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			ASSERT_EQ(queue.read().unwrap(), 0);
+		}
+
+		for(auto i = 1; i < 5; ++i) {
+			ASSERT_EQ(queue.read().unwrap(), i);
+		}
+	}
+
+	TEST(LockFreeQueueTest, spscWaitForSpaceWakesOnNotify) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 4, QueueConcurrency::SPSC>();
+		for(auto i = 0; i < 4; ++i) {
+			ASSERT_TRUE(queue.push(i).is_ok());
+		}
+
+		{
+			auto producer = std::jthread([&queue]() {
+				queue.wait_for_space();
+				ASSERT_TRUE(queue.push(4).is_ok());
+			});
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			ASSERT_EQ(queue.read().unwrap(), 0);
+			queue.notify_popped();
+		}
+
+		for(auto i = 1; i < 5; ++i) {
+			ASSERT_EQ(queue.read().unwrap(), i);
+		}
+	}
+
+	TEST(LockFreeQueueTest, waitForSpaceTimesOut) {
+		auto queue = LockFreeQueue<int, QueuePolicy::ErrWhenFull, 4>();
+		for(auto i = 0; i < 4; ++i) {
+			ASSERT_TRUE(queue.push(i).is_ok());
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		ASSERT_FALSE(queue.wait_for_space(std::chrono::milliseconds(5)));
+		ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(5));
+
+		{
+			auto producer = std::jthread([&queue]() {
+				ASSERT_TRUE(queue.wait_for_space(std::chrono::seconds(10)));
+				ASSERT_TRUE(queue.push(4).is_ok());
+			});
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			ASSERT_EQ(queue.read().unwrap(), 0);
+		}
+
+		for(auto i = 1; i < 5; ++i) {
+			ASSERT_EQ(queue.read().unwrap(), i);
+		}
+	}
+} // namespace hyperion::utils::test
@@ -3,6 +3,37 @@
 #include <HyperionUtils/Logger.h>
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <sstream>
+
+namespace hyperion::test {
+	/// @brief Trivially copyable, but formats text it doesn't own
+	struct BorrowedText {
+		const char* text;
+	};
+
+	/// @brief Trivially copyable, and owns everything it formats
+	struct OwnedPoint {
+		int x;
+		int y;
+	};
+} // namespace hyperion::test
+
+/// @brief Opts `OwnedPoint` in to deferred formatting
+template<>
+struct hyperion::is_deferrable_argument<hyperion::test::OwnedPoint> : std::true_type { };
+
+template<>
+struct fmt::formatter<hyperion::test::BorrowedText> : fmt::formatter<fmt::string_view> {
+	template<typename FormatContext>
+	auto format(const hyperion::test::BorrowedText& borrowed, FormatContext& context) {
+		return fmt::formatter<fmt::string_view>::format(borrowed.text, context);
+	}
+};
+
 namespace hyperion::test {
 	using hyperion::LoggerLevel;
 	using hyperion::LoggerPolicy;
@@ -27,4 +58,901 @@ namespace hyperion::test {
 
 		ASSERT_TRUE(true);
 	}
+
+	TEST(LoggerTest, loggingPerThread) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>,
+											LoggerBuffering<LogBuffering::PerThread>>;
+
+		constexpr auto num_threads = 4;
+		constexpr auto num_entries = 512;
+		auto logger = Logger<Parameters>("PerThreadTest"s);
+		auto all_logged = std::atomic<bool>(true);
+
+		{
+			auto threads = std::vector<std::jthread>();
+			for(int thread = 0; thread < num_threads; ++thread) {
+				threads.emplace_back([&logger, &all_logged, thread]() {
+					for(int i = 0; i < num_entries; ++i) {
+						if(logger.info(None(), "{0}{1}", thread, i).is_err()) {
+							all_logged.store(false);
+						}
+					}
+				});
+			}
+		}
+
+		ASSERT_TRUE(all_logged.load());
+	}
+
+	TEST(LoggerTest, entryInlineAndSpilled) {
+		auto short_entry = Entry(LogLevel::WARN, "{0} {1}", "short"s, 4);
+		ASSERT_TRUE(short_entry.is_inline());
+		ASSERT_EQ(short_entry.level(), LogLevel::WARN);
+		ASSERT_EQ(short_entry.entry(), "short 4"s);
+		ASSERT_EQ(Entry(ErrorEntry("error"s)).level(), LogLevel::ERROR);
+
+		const auto long_text = std::string(Entry::INLINE_CAPACITY, 'a');
+		auto long_entry = Entry(LogLevel::INFO, "{}", long_text);
+		long_entry.append("{}", 'b');
+		ASSERT_FALSE(long_entry.is_inline());
+		ASSERT_EQ(long_entry.entry(), long_text + "b"s);
+
+		long_entry.append("{}", "cd"s);
+		ASSERT_EQ(long_entry.entry(), long_text + "bcd"s);
+
+		const auto copy = long_entry; // NOLINT
+		ASSERT_EQ(copy.entry(), long_entry.entry());
+
+		auto moved = std::move(long_entry);
+		ASSERT_EQ(moved.entry(), long_text + "bcd"s);
+		// the moved-from entry no longer holds the spilled text, so it's left empty
+		ASSERT_TRUE(long_entry.entry().empty()); // NOLINT(bugprone-use-after-move)
+		const auto copy_of_moved_from = long_entry; // NOLINT(bugprone-use-after-move)
+		ASSERT_TRUE(copy_of_moved_from.entry().empty());
+
+		auto move_assigned = Entry(LogLevel::TRACE, "{}", "short"s);
+		move_assigned = std::move(moved);
+		ASSERT_EQ(move_assigned.entry(), long_text + "bcd"s);
+		ASSERT_TRUE(moved.entry().empty()); // NOLINT(bugprone-use-after-move)
+		moved = std::move(move_assigned);
+
+		short_entry = moved;
+		ASSERT_EQ(short_entry.entry(), moved.entry());
+		ASSERT_EQ(short_entry.level(), LogLevel::INFO);
+	}
+
+	TEST(LoggerTest, entryFields) {
+		const auto path = "/index path"s;
+		auto entry = Entry::logged(LogLevel::INFO, 3_usize, "[time]");
+		entry.append("{} {}", "request", "finished");
+		entry.end_message(field("status", 200),
+						  field("path", path),
+						  field("ratio", 0.5),
+						  field("ok", true));
+
+		ASSERT_EQ(entry.entry(),
+				  "[time]  [Thread ID: 3] [INFO]: request finished status=200 path=/index path "
+				  "ratio=0.5 ok=true\n"s);
+		ASSERT_EQ(entry.message(), "request finished"s);
+		ASSERT_EQ(entry.time_stamp(), "[time]"s);
+		ASSERT_EQ(entry.thread_id(), 3_usize);
+		ASSERT_TRUE(entry.has_fields());
+
+		const auto check_fields = [&path](const Entry& to_check) {
+			auto num_fields = 0;
+			to_check.for_each_field([&](std::string_view key, const FieldValue& value) {
+				switch(num_fields++) {
+					case 0:
+						ASSERT_EQ(key, "status"s);
+						ASSERT_EQ(std::get<i64>(value), 200);
+						break;
+					case 1:
+						ASSERT_EQ(key, "path"s);
+						ASSERT_EQ(std::get<std::string_view>(value), path);
+						break;
+					case 2: ASSERT_EQ(std::get<double>(value), 0.5); break;
+					default: ASSERT_TRUE(std::get<bool>(value));
+				}
+			});
+			ASSERT_EQ(num_fields, 4);
+		};
+		check_fields(entry);
+
+		// fields survive the entry spilling, being copied, and being moved
+		auto spilled = Entry::logged(LogLevel::WARN, 3_usize, "[time]");
+		spilled.append("{}", std::string(Entry::INLINE_CAPACITY - 64_usize, 'a'));
+		spilled.end_message(field("status", 200),
+							field("path", path),
+							field("ratio", 0.5),
+							field("ok", true));
+		ASSERT_FALSE(spilled.is_inline());
+		ASSERT_EQ(spilled.message().size(), Entry::INLINE_CAPACITY - 64_usize);
+		check_fields(spilled);
+
+		const auto copy = spilled; // NOLINT
+		check_fields(copy);
+		auto moved = std::move(spilled);
+		check_fields(moved);
+		moved = entry;
+		check_fields(moved);
+		ASSERT_EQ(moved.message(), "request finished"s);
+
+		const auto plain = Entry(LogLevel::INFO, "{}", "plain"s);
+		ASSERT_FALSE(plain.is_logged());
+		ASSERT_FALSE(plain.has_fields());
+		ASSERT_EQ(plain.message(), "plain"s);
+	}
+
+	TEST(LoggerTest, deferredEntryFormatting) {
+		const auto now = DeferredEntry::clock::now();
+		auto buffer = fmt::memory_buffer();
+
+		const auto deferred = DeferredEntry(LogLevel::INFO, 1_usize, now, "{0} {1} {2}", 4, 2.5, 'c');
+		deferred.format_to(buffer);
+		ASSERT_EQ(fmt::to_string(buffer), "4 2.5 c"s);
+
+		buffer.clear();
+		const auto formatted = DeferredEntry(LogLevel::WARN, 2_usize, now, "already formatted"s);
+		formatted.format_to(buffer);
+		ASSERT_EQ(fmt::to_string(buffer), "already formatted"s);
+		ASSERT_EQ(formatted.level(), LogLevel::WARN);
+		ASSERT_EQ(formatted.thread_id(), 2_usize);
+	}
+
+	TEST(LoggerTest, loggingDeferred) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>,
+											LoggerBuffering<LogBuffering::PerThread>,
+											LoggerFormatting<LogFormatting::Deferred>>;
+
+		constexpr auto num_threads = 4;
+		constexpr auto num_entries = 512;
+		auto logger = Logger<Parameters>("DeferredTest"s);
+		auto all_logged = std::atomic<bool>(true);
+
+		{
+			auto threads = std::vector<std::jthread>();
+			for(int thread = 0; thread < num_threads; ++thread) {
+				threads.emplace_back([&logger, &all_logged, thread]() {
+					for(int i = 0; i < num_entries; ++i) {
+						// alternate between arguments that can be deferred and ones that can't
+						const auto result
+							= i % 2 == 0 ? logger.info(None(), FMT_STRING("{0}{1}"), thread, i) :
+											 logger.info(None(), FMT_STRING("{0}{1}"), "info"s, i);
+						if(result.is_err()) {
+							all_logged.store(false);
+						}
+					}
+				});
+			}
+		}
+
+		ASSERT_TRUE(all_logged.load());
+	}
+
+	TEST(LoggerTest, deferredRuntimeFormatString) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>,
+											LoggerBuffering<LogBuffering::Shared>,
+											LoggerFormatting<LogFormatting::Deferred>>;
+
+		constexpr auto num_entries = 8;
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto path = (directory / "DeferredRuntimeFormatStringTest.log").string();
+
+		{
+			auto sinks = Sinks();
+			sinks.push_back(
+				make_sink<FileSink<>>(std::make_unique<fmt::ostream>(fmt::output_file(path))));
+			auto logger = Logger<Parameters>(std::move(sinks));
+
+			// a format string built at runtime is overwritten before the logger's thread would
+			// format it, so it must be formatted immediately, even though it's a character array
+			char format_string[32] = {}; // NOLINT(modernize-avoid-c-arrays)
+			for(int i = 0; i < num_entries; ++i) {
+				*fmt::format_to(format_string, "runtime {} {{}}", i) = '\0';
+				ASSERT_TRUE(logger.info(None(), format_string, i).is_ok());
+			}
+		}
+
+		auto file = std::ifstream(path);
+		const auto text
+			= std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		for(int i = 0; i < num_entries; ++i) {
+			ASSERT_NE(text.find(fmt::format("runtime {0} {0}", i)), std::string::npos);
+		}
+	}
+
+	TEST(LoggerTest, deferredArgumentsMustOwnWhatTheyFormat) {
+		static_assert(DeferredEntry::is_deferrable<int, double, char, bool, LogLevel>);
+		static_assert(DeferredEntry::is_deferrable<OwnedPoint>);
+		static_assert(!DeferredEntry::is_deferrable<BorrowedText>);
+		static_assert(!DeferredEntry::is_deferrable<std::span<const int>>);
+		static_assert(!DeferredEntry::is_deferrable<Span<const int>>);
+		static_assert(!DeferredEntry::is_deferrable<std::string_view>);
+		static_assert(!DeferredEntry::is_deferrable<const char*>);
+
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>,
+											LoggerBuffering<LogBuffering::Shared>,
+											LoggerFormatting<LogFormatting::Deferred>>;
+
+		constexpr auto num_entries = 8;
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto path = (directory / "DeferredBorrowedArgumentTest.log").string();
+
+		{
+			auto sinks = Sinks();
+			sinks.push_back(
+				make_sink<FileSink<>>(std::make_unique<fmt::ostream>(fmt::output_file(path))));
+			auto logger = Logger<Parameters>(std::move(sinks));
+
+			// the text is overwritten before the logger's thread would format the entry, so an
+			// argument referring to it must be formatted immediately, even though it's trivially
+			// copyable
+			char text[32] = {}; // NOLINT(modernize-avoid-c-arrays)
+			for(int i = 0; i < num_entries; ++i) {
+				*fmt::format_to(text, "borrowed {}", i) = '\0';
+				const auto borrowed = BorrowedText{text};
+				ASSERT_TRUE(logger.info(None(), FMT_STRING("{} {}"), borrowed, i).is_ok());
+			}
+		}
+
+		auto file = std::ifstream(path);
+		const auto text
+			= std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		for(int i = 0; i < num_entries; ++i) {
+			ASSERT_NE(text.find(fmt::format("borrowed {0} {0}", i)), std::string::npos);
+		}
+	}
+
+	TEST(LoggerTest, levelFiltering) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::DropWhenFull>,
+											LoggerLevel<LogLevel::INFO>>;
+
+		auto logger = Logger<Parameters>("LevelFilteringTest"s);
+		auto num_evaluated = 0;
+		const auto argument = [&num_evaluated]() { return ++num_evaluated; };
+
+		static_assert(!Logger<Parameters>::is_enabled<LogLevel::TRACE>());
+		static_assert(Logger<Parameters>::is_enabled<LogLevel::INFO>());
+
+		// below the compile-time minimum level
+		HYPERION_LOG_TRACE(logger, None(), "{}", argument());
+		ASSERT_EQ(num_evaluated, 0);
+		ASSERT_TRUE(logger.trace(None(), "{}", 1).is_err());
+
+		HYPERION_LOG_INFO(logger, None(), "{}", argument());
+		ASSERT_EQ(num_evaluated, 1);
+
+		// below the runtime minimum level
+		logger.set_level(LogLevel::ERROR);
+		ASSERT_EQ(logger.level(), LogLevel::ERROR);
+		ASSERT_FALSE(logger.should_log<LogLevel::WARN>());
+		HYPERION_LOG_WARN(logger, None(), "{}", argument());
+		ASSERT_EQ(num_evaluated, 1);
+		ASSERT_TRUE(logger.warn(None(), "{}", 1).is_err());
+
+		HYPERION_LOG_ERROR(logger, None(), "{}", argument());
+		ASSERT_EQ(num_evaluated, 2);
+		ASSERT_TRUE(logger.error(None(), "{}", 1).is_ok());
+	}
+
+	TEST(LoggerTest, timeStampCache) {
+		auto& cache = TimeStampCache::instance();
+		const auto time = std::time(nullptr);
+		const auto expected = fmt::format("[{:%Y-%m-%d|%H-%M-%S}]", fmt::localtime(time));
+		ASSERT_EQ(cache.time_stamp(time).view(), expected);
+
+		const auto seconds = cache.now();
+		ASSERT_EQ(seconds.view().size(), TimeStamp::SECONDS_LENGTH);
+
+		const auto millis_stamp = cache.now<LogTimeStampPrecision::Milliseconds>();
+		const auto millis = millis_stamp.view();
+		ASSERT_EQ(millis.size(), TimeStamp::SECONDS_LENGTH + 4_usize);
+		ASSERT_EQ(millis[TimeStamp::SECONDS_LENGTH - 1_usize], '.');
+		ASSERT_EQ(millis.back(), ']');
+
+		const auto micros = cache.time_stamp<LogTimeStampPrecision::Microseconds>(
+			std::chrono::system_clock::from_time_t(time) + std::chrono::microseconds(1234));
+		ASSERT_EQ(micros.view(), expected.substr(0, expected.size() - 1) + ".001234]"s);
+	}
+
+	TEST(LoggerTest, timeStampCacheConcurrentReads) {
+		constexpr auto num_threads = 4;
+		constexpr auto num_reads = 10000;
+		auto all_valid = std::atomic<bool>(true);
+
+		{
+			auto threads = std::vector<std::jthread>();
+			for(int thread = 0; thread < num_threads; ++thread) {
+				threads.emplace_back([&all_valid]() {
+					for(int i = 0; i < num_reads; ++i) {
+						const auto stamp
+							= TimeStampCache::instance().now<LogTimeStampPrecision::Milliseconds>();
+						const auto view = stamp.view();
+						if(view.size() != TimeStamp::SECONDS_LENGTH + 4_usize || view.front() != '['
+						   || view.back() != ']')
+						{
+							all_valid.store(false);
+						}
+					}
+				});
+			}
+		}
+
+		ASSERT_TRUE(all_valid.load());
+	}
+
+	TEST(LoggerTest, loggingToMultipleSinks) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>>;
+
+		constexpr auto num_entries = 1024;
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto first_path = (directory / "MultipleSinksTest1.log").string();
+		const auto second_path = (directory / "MultipleSinksTest2.log").string();
+
+		{
+			auto sinks = Sinks();
+			sinks.push_back(make_sink<FileSink<>>(
+				std::make_unique<fmt::ostream>(fmt::output_file(first_path))));
+			sinks.push_back(make_sink<FileSink<>>(
+				std::make_unique<fmt::ostream>(fmt::output_file(second_path))));
+			auto logger = Logger<Parameters>(std::move(sinks));
+
+			for(int i = 0; i < num_entries; ++i) {
+				ASSERT_TRUE(logger.info(None(), "{}", i).is_ok());
+			}
+		}
+
+		// every entry should have been sunk to both sinks by the time the logger is destroyed
+		for(const auto& path : {first_path, second_path}) {
+			auto file = std::ifstream(path);
+			auto num_lines = 0;
+			for(auto line = std::string(); std::getline(file, line);) {
+				++num_lines;
+			}
+			ASSERT_EQ(num_lines, num_entries);
+		}
+	}
+
+	TEST(LoggerTest, fileSinkCoalescesEntries) {
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto path = (directory / "FileSinkBatchTest.log").string();
+
+		const auto read_file = [&path]() {
+			auto file = std::ifstream(path);
+			return std::string(std::istreambuf_iterator<char>(file),
+							   std::istreambuf_iterator<char>());
+		};
+
+		auto sink = FileSink<>(std::make_unique<fmt::ostream>(fmt::output_file(path)),
+							   FileFlushThreshold{.bytes = 1024_usize * 1024_usize,
+												  .interval = std::chrono::hours(1)});
+		auto entries = std::array<Entry, 3>{Entry(LogLevel::INFO, "{}\n", 1),
+											Entry(LogLevel::WARN, "{}\n", "{braces}"s),
+											Entry(LogLevel::ERROR, "{}\n", 3)};
+		sink.sink_batch(Span<const Entry>::make_span(entries.data(), entries.size()));
+
+		// below both thresholds, so nothing should have been written yet
+		ASSERT_TRUE(read_file().empty());
+
+		sink.flush();
+		ASSERT_EQ(read_file(), "1\n{braces}\n3\n"s);
+	}
+
+	TEST(LoggerTest, fileSinkMoveAssignmentFlushes) {
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto first_path = (directory / "FileSinkMoveTest1.log").string();
+		const auto second_path = (directory / "FileSinkMoveTest2.log").string();
+		const auto third_path = (directory / "FileSinkMoveTest3.log").string();
+
+		const auto read_file = [](const std::string& path) {
+			auto file = std::ifstream(path);
+			return std::string(std::istreambuf_iterator<char>(file),
+							   std::istreambuf_iterator<char>());
+		};
+		const auto threshold = FileFlushThreshold{.bytes = 1024_usize * 1024_usize,
+												  .interval = std::chrono::hours(1)};
+
+		{
+			auto sink = FileSink<>(std::make_unique<fmt::ostream>(fmt::output_file(first_path)),
+								   threshold);
+			sink.sink(Entry(LogLevel::INFO, "{}\n", 1));
+			ASSERT_TRUE(read_file(first_path).empty());
+
+			// the entry buffered for the first file should be written before it's replaced
+			sink = FileSink<>(std::make_unique<fmt::ostream>(fmt::output_file(second_path)),
+							  threshold);
+			ASSERT_EQ(read_file(first_path), "1\n"s);
+
+			// and the same when assigning through `Sink`
+			auto wrapped = make_sink<FileSink<>>(std::move(sink));
+			wrapped.sink(Entry(LogLevel::INFO, "{}\n", 2));
+			ASSERT_TRUE(read_file(second_path).empty());
+			wrapped = make_sink<FileSink<>>(
+				std::make_unique<fmt::ostream>(fmt::output_file(third_path)),
+				threshold);
+			ASSERT_EQ(read_file(second_path), "2\n"s);
+		}
+	}
+
+#ifdef HYPERION_HAS_MAPPED_FILE_SINK
+	TEST(LoggerTest, mappedFileSinkRollsSegments) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>>;
+
+		constexpr auto num_entries = 1000;
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto path = directory / "MappedFileSinkTest.log";
+
+		{
+			// a single-page segment size, so the entries span several segments
+			auto sink = MappedFileSink::create_file(path, 1_usize);
+			ASSERT_TRUE(sink.is_ok());
+
+			auto sinks = Sinks();
+			sinks.push_back(Sink(sink.unwrap()));
+			auto logger = Logger<Parameters>(std::move(sinks));
+
+			for(int i = 0; i < num_entries; ++i) {
+				ASSERT_TRUE(logger.info(None(), "{}", i).is_ok());
+			}
+		}
+
+		auto file = std::ifstream(path);
+		auto num_lines = 0;
+		for(auto line = std::string(); std::getline(file, line);) {
+			ASSERT_NE(line.find(fmt::format("[INFO]: {}", num_lines)), std::string::npos);
+			++num_lines;
+		}
+		ASSERT_EQ(num_lines, num_entries);
+	}
+#endif
+
+#ifdef HYPERION_HAS_ASYNC_FILE_SINK
+	TEST(LoggerTest, asyncFileSinkWritesInOrder) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>>;
+
+		constexpr auto num_entries = 4096;
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto path = directory / "AsyncFileSinkTest.log";
+
+		{
+			// small buffers, so they're written while others are still in flight
+			auto result = AsyncFileSink::create_file(
+				path,
+				AsyncFileBuffers{.size = 1024_usize, .count = 2_usize});
+			ASSERT_TRUE(result.is_ok());
+
+			auto sinks = Sinks();
+			sinks.push_back(make_sink<AsyncFileSink>(result.unwrap()));
+			auto logger = Logger<Parameters>(std::move(sinks));
+
+			for(int i = 0; i < num_entries; ++i) {
+				ASSERT_TRUE(logger.info(None(), "{}", i).is_ok());
+			}
+		}
+
+		auto file = std::ifstream(path);
+		auto num_lines = 0;
+		for(auto line = std::string(); std::getline(file, line);) {
+			ASSERT_NE(line.find(fmt::format("[INFO]: {}", num_lines)), std::string::npos);
+			++num_lines;
+		}
+		ASSERT_EQ(num_lines, num_entries);
+	}
+#endif
+
+	TEST(LoggerTest, fileSinkRotation) {
+		constexpr auto max_bytes = 100_usize;
+		constexpr auto max_files = 3_usize;
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("HyperionRotationTest");
+		std::filesystem::remove_all(directory);
+
+		{
+			auto result = FileSink<>::create_rotating(
+				FileRotation{.max_bytes = max_bytes, .max_files = max_files},
+				"RotationTest",
+				"HyperionRotationTest");
+			ASSERT_TRUE(result.is_ok());
+			auto sink = result.unwrap();
+
+			// with the default `FileFlushThreshold`, all of these are buffered at once, so the
+			// file has to be rotated before each entry that would take it past `max_bytes`
+			auto entries = std::vector<Entry>();
+			for(int i = 0; i < 25; ++i) {
+				entries.emplace_back(LogLevel::INFO, "entry number {}\n", i);
+			}
+			sink.sink_batch(Span<const Entry>::make_span(entries.data(), entries.size()));
+			for(int i = 25; i < 50; ++i) {
+				sink.sink(Entry(LogLevel::INFO, "entry number {}\n", i));
+			}
+			ASSERT_EQ(sink.files().size(), max_files);
+		}
+
+		auto num_files = 0_usize;
+		auto text = std::string();
+		for(const auto& file : std::filesystem::directory_iterator(directory)) {
+			ASSERT_LE(file.file_size(), max_bytes);
+			auto stream = std::ifstream(file.path());
+			text.append(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+			++num_files;
+		}
+		ASSERT_EQ(num_files, max_files);
+		ASSERT_NE(text.find("entry number 49\n"), std::string::npos);
+	}
+
+	TEST(LoggerTest, fileSinkRotatesByIntervalWhileIdle) {
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("HyperionIntervalRotationTest");
+		std::filesystem::remove_all(directory);
+
+		auto result
+			= FileSink<>::create_rotating(FileRotation{.interval = std::chrono::seconds(1)},
+										  "IntervalRotationTest",
+										  "HyperionIntervalRotationTest");
+		ASSERT_TRUE(result.is_ok());
+		auto sink = result.unwrap();
+
+		sink.sink(Entry(LogLevel::INFO, "{}\n", 1));
+		sink.flush();
+		ASSERT_EQ(sink.files().size(), 1_usize);
+
+		// nothing more is logged, but flushing the idle sink once the interval has elapsed
+		// should still move it on to a new file
+		std::this_thread::sleep_for(std::chrono::milliseconds(1100)); // NOLINT
+		sink.flush();
+		ASSERT_EQ(sink.files().size(), 2_usize);
+
+		// and an empty file isn't rotated again
+		std::this_thread::sleep_for(std::chrono::milliseconds(1100)); // NOLINT
+		sink.flush();
+		ASSERT_EQ(sink.files().size(), 2_usize);
+	}
+
+	TEST(LoggerTest, binaryFileSinkRoundTrip) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>,
+											LoggerBuffering<LogBuffering::Shared>,
+											LoggerFormatting<LogFormatting::Deferred>>;
+
+		constexpr auto num_entries = 256;
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto binary_path = (directory / "BinaryFileSinkTest.hlog").string();
+		const auto text_path = (directory / "BinaryFileSinkTest.log").string();
+
+		{
+			auto sinks = Sinks();
+			sinks.push_back(make_sink<BinaryFileSink>(
+				std::make_unique<fmt::ostream>(fmt::output_file(binary_path))));
+			sinks.push_back(make_sink<FileSink<>>(
+				std::make_unique<fmt::ostream>(fmt::output_file(text_path))));
+			auto logger = Logger<Parameters>(std::move(sinks));
+
+			for(int i = 0; i < num_entries; ++i) {
+				// deferred arguments of each kind, and an argument that can't be deferred
+				ASSERT_TRUE(
+					logger.info(None(), FMT_STRING("{} {:x} {:.2f} {} {}"), i, 255U, 0.5, 'c', true)
+						.is_ok());
+				ASSERT_TRUE(logger.warn(None(), FMT_STRING("{}: {}"), "entry"s, i).is_ok());
+			}
+		}
+
+		const auto read_file = [](const std::string& path) {
+			auto file = std::ifstream(path, std::ios::binary);
+			return std::string(std::istreambuf_iterator<char>(file),
+							   std::istreambuf_iterator<char>());
+		};
+		// the entries were deferred, so their format string was registered instead of their text
+		// being written
+		ASSERT_NE(read_file(binary_path).find("{} {:x} {:.2f} {} {}"), std::string::npos);
+		auto decoded = fmt::memory_buffer();
+		auto result = binary_log::decode(read_file(binary_path), decoded);
+		ASSERT_TRUE(result.is_ok());
+		ASSERT_EQ(result.unwrap(), 2_usize * num_entries);
+
+		// the time stamps of the two files can differ, so compare everything after them
+		const auto strip_time_stamps = [](const std::string& text) {
+			auto stripped = std::string();
+			auto stream = std::istringstream(text);
+			for(auto line = std::string(); std::getline(stream, line);) {
+				stripped += line.substr(line.find("]  ")) + "\n";
+			}
+			return stripped;
+		};
+		const auto expected = strip_time_stamps(read_file(text_path));
+		ASSERT_NE(expected.find("] [INFO]: 7 ff 0.50 c true\n"), std::string::npos);
+		ASSERT_EQ(strip_time_stamps(std::string(decoded.data(), decoded.size())), expected);
+
+		auto not_a_log = fmt::memory_buffer();
+		ASSERT_TRUE(binary_log::decode("not a binary log", not_a_log).is_err());
+
+		const auto make_log = [](std::string_view format_string, u8 level) {
+			auto buffer = fmt::memory_buffer();
+			buffer.append(binary_log::MAGIC.data(),
+						  binary_log::MAGIC.data() + binary_log::MAGIC.size()); // NOLINT
+			binary_log::write(buffer, binary_log::RecordKind::Format);
+			binary_log::write(buffer, 0_u32);
+			binary_log::write_string(buffer, format_string);
+			binary_log::write(buffer, binary_log::RecordKind::Entry);
+			binary_log::write(buffer, 0_u32);
+			binary_log::write(buffer, level);
+			binary_log::write(buffer, 0_u64);
+			binary_log::write(buffer, i64(0));
+			binary_log::write(buffer, u8(1));
+			binary_log::write_argument(buffer, "text"s);
+			return std::string(buffer.data(), buffer.size());
+		};
+		auto malformed = fmt::memory_buffer();
+		ASSERT_EQ(binary_log::decode(make_log("{}", 2U), malformed).unwrap(), 1_usize);
+		// an argument that doesn't match its format string, a format string that isn't one, and a
+		// level that doesn't exist are errors, not exceptions
+		ASSERT_TRUE(binary_log::decode(make_log("{:d}", 2U), malformed).is_err());
+		ASSERT_TRUE(binary_log::decode(make_log("{", 2U), malformed).is_err());
+		ASSERT_TRUE(binary_log::decode(make_log("{}", 200U), malformed).is_err());
+	}
+
+	TEST(LoggerTest, jsonSink) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>>;
+
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto json_path = (directory / "JsonSinkTest.jsonl").string();
+		const auto text_path = (directory / "JsonSinkTest.log").string();
+
+		{
+			auto sinks = Sinks();
+			sinks.push_back(make_sink<JsonSink>(
+				std::make_unique<fmt::ostream>(fmt::output_file(json_path))));
+			sinks.push_back(make_sink<FileSink<>>(
+				std::make_unique<fmt::ostream>(fmt::output_file(text_path))));
+			auto logger = Logger<Parameters>(std::move(sinks));
+
+			const auto user = "a \"quoted\"\tname"s;
+			ASSERT_TRUE(logger
+							.info(Some(7_usize),
+								  "request {} finished",
+								  12,
+								  field("status", 200),
+								  field("user", user),
+								  field("ok", false))
+							.is_ok());
+			ASSERT_TRUE(logger.warn(Some(7_usize), "no fields").is_ok());
+		}
+
+		auto json = std::ifstream(json_path);
+		auto lines = std::vector<std::string>();
+		for(auto line = std::string(); std::getline(json, line);) {
+			lines.push_back(line);
+		}
+		ASSERT_EQ(lines.size(), 2_usize);
+
+		const auto after_time = [](const std::string& line) {
+			return line.substr(line.find(",\"thread\""));
+		};
+		ASSERT_TRUE(lines[0].starts_with("{\"time\":\""));
+		ASSERT_EQ(after_time(lines[0]),
+				  ",\"thread\":7,\"level\":\"INFO\",\"message\":\"request 12 finished\","
+				  "\"status\":200,\"user\":\"a \\\"quoted\\\"\\tname\",\"ok\":false}"s);
+		ASSERT_EQ(after_time(lines[1]),
+				  ",\"thread\":7,\"level\":\"WARN\",\"message\":\"no fields\"}"s);
+
+		// text sinks get the fields rendered onto the end of the entry
+		auto text = std::ifstream(text_path);
+		auto first_line = std::string();
+		std::getline(text, first_line);
+		ASSERT_TRUE(first_line.ends_with(
+			"request 12 finished status=200 user=a \"quoted\"\tname ok=false"s));
+	}
+
+	TEST(LoggerTest, flushTimeout) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>>;
+
+		constexpr auto num_threads = 4;
+		constexpr auto num_entries = 2048;
+		auto logger = Logger<Parameters>("FlushTimeoutTest"s);
+		ASSERT_TRUE(logger.flush_timeout().is_none());
+		logger.set_flush_timeout(Some(std::chrono::nanoseconds(std::chrono::microseconds(50))));
+		ASSERT_EQ(logger.flush_timeout().unwrap(), std::chrono::microseconds(50));
+
+		auto num_logged = std::atomic<u64>(0_u64);
+		auto all_valid = std::atomic<bool>(true);
+		{
+			auto threads = std::vector<std::jthread>();
+			for(int thread = 0; thread < num_threads; ++thread) {
+				threads.emplace_back([&logger, &num_logged, &all_valid, thread]() {
+					for(int i = 0; i < num_entries; ++i) {
+						auto result = logger.info(None(), "{0}{1}", thread, i);
+						if(result.is_ok()) {
+							num_logged.fetch_add(1_u64);
+						}
+						else if(result.unwrap_err().error_code()
+								!= make_error_code(LogErrorType::FlushTimeout))
+						{
+							all_valid.store(false);
+						}
+					}
+				});
+			}
+		}
+
+		ASSERT_TRUE(all_valid.load());
+		const auto stats = logger.stats();
+		ASSERT_EQ(stats.entries_enqueued, num_logged.load());
+		ASSERT_EQ(stats.entries_enqueued + stats.entries_dropped,
+				  static_cast<u64>(num_threads * num_entries));
+
+		logger.set_flush_timeout(None());
+		ASSERT_TRUE(logger.flush_timeout().is_none());
+	}
+
+	TEST(LoggerTest, loggerStatistics) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::DropWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>>;
+
+		constexpr auto num_entries = 4096_u64;
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto path = (directory / "StatisticsTest.log").string();
+
+		auto sinks = Sinks();
+		sinks.push_back(
+			make_sink<FileSink<>>(std::make_unique<fmt::ostream>(fmt::output_file(path))));
+		auto logger = Logger<Parameters>(std::move(sinks));
+
+		auto num_logged = 0_u64;
+		for(auto i = 0_u64; i < num_entries; ++i) {
+			if(logger.info(None(), "{}", i).is_ok()) {
+				++num_logged;
+			}
+		}
+
+		auto stats = logger.stats();
+		ASSERT_EQ(stats.entries_enqueued, num_logged);
+		ASSERT_EQ(stats.entries_enqueued + stats.entries_dropped, num_entries);
+		ASSERT_EQ(stats.entries_overwritten, 0_u64);
+		ASSERT_EQ(stats.bytes_sunk.size(), 1_usize);
+
+		// wait for the message thread to catch up
+		while(stats.consumer_lag != 0_u64) {
+			std::this_thread::yield();
+			stats = logger.stats();
+		}
+		ASSERT_EQ(stats.entries_sunk, num_logged);
+		ASSERT_GT(stats.queue_high_water_mark, 0_usize);
+		ASSERT_GT(stats.bytes_sunk[0], 0_u64);
+	}
+
+	TEST(LoggerTest, callSiteLimits) {
+		auto registry = CallSiteRegistry();
+		ASSERT_TRUE(registry.empty());
+
+		auto sampled = CallSite(std::source_location::current(), 0_u32, 4_u32);
+		auto num_sampled = 0_u64;
+		for(auto i = 0; i < 100; ++i) {
+			if(sampled.should_log(registry)) {
+				++num_sampled;
+			}
+		}
+		ASSERT_EQ(num_sampled, 25_u64);
+		ASSERT_FALSE(registry.empty());
+		ASSERT_EQ(sampled.take_suppressed(), 75_u64);
+		ASSERT_EQ(sampled.take_suppressed(), 0_u64);
+
+		auto limited = CallSite(std::source_location::current(), 10_u32, 1_u32);
+		auto num_limited = 0_u64;
+		for(auto i = 0; i < 100; ++i) {
+			if(limited.should_log(registry)) {
+				++num_limited;
+			}
+		}
+		// the loop may straddle a one-second boundary
+		ASSERT_GE(num_limited, 10_u64);
+		ASSERT_LE(num_limited, 20_u64);
+		ASSERT_EQ(limited.take_suppressed(), 100_u64 - num_limited);
+
+		auto num_registered = 0_usize;
+		registry.for_each([&](CallSite& site) {
+			ASSERT_TRUE(&site == &sampled || &site == &limited);
+			++num_registered;
+		});
+		ASSERT_EQ(num_registered, 2_usize);
+	}
+
+	TEST(LoggerTest, callSiteRegistersWithEachRegistry) {
+		auto site = CallSite(std::source_location::current(), 0_u32, 2_u32);
+		const auto count = [&site](const CallSiteRegistry& registry) {
+			auto num_registered = 0_usize;
+			registry.for_each([&](CallSite& registered) {
+				ASSERT_EQ(&registered, &site);
+				++num_registered;
+			});
+			return num_registered;
+		};
+		const auto suppress = [&site](CallSiteRegistry& registry) {
+			while(site.should_log(registry)) {
+			}
+		};
+
+		{
+			// ie: a `Logger` that has since been destroyed
+			auto first = CallSiteRegistry();
+			suppress(first);
+			ASSERT_EQ(count(first), 1_usize);
+		}
+
+		auto second = CallSiteRegistry();
+		suppress(second);
+		ASSERT_EQ(count(second), 1_usize);
+
+		// logging to two `Logger`s in turn registers the site with both, but only once each
+		auto third = CallSiteRegistry();
+		for(auto i = 0; i < 4; ++i) {
+			suppress(third);
+			suppress(second);
+		}
+		ASSERT_EQ(count(second), 1_usize);
+		ASSERT_EQ(count(third), 1_usize);
+	}
+
+	TEST(LoggerTest, sampledStatementReportsSuppressed) {
+		using Parameters = LoggerParameters<LoggerPolicy<LogPolicy::FlushWhenFull>,
+											LoggerLevel<LogLevel::MESSAGE>>;
+
+		auto directory = std::filesystem::temp_directory_path();
+		directory.append("Hyperion");
+		std::filesystem::create_directory(directory);
+		const auto path = (directory / "SampledStatementTest.log").string();
+
+		{
+			auto sinks = Sinks();
+			sinks.push_back(
+				make_sink<FileSink<>>(std::make_unique<fmt::ostream>(fmt::output_file(path))));
+			auto logger = Logger<Parameters>(std::move(sinks));
+
+			for(auto i = 0; i < 100; ++i) {
+				HYPERION_LOG_SAMPLED(logger, LogLevel::INFO, 10, None(), "sampled entry {}", i);
+			}
+		}
+
+		auto file = std::ifstream(path);
+		auto num_sampled = 0_usize;
+		auto summary = std::string();
+		for(auto line = std::string(); std::getline(file, line);) {
+			if(line.find("sampled entry") != std::string::npos) {
+				++num_sampled;
+			}
+			else if(line.find("suppressed=") != std::string::npos) {
+				summary = line;
+			}
+		}
+		ASSERT_EQ(num_sampled, 10_usize);
+		ASSERT_NE(summary.find("suppressed=90 "), std::string::npos);
+		ASSERT_NE(summary.find("LoggerTest.h"), std::string::npos);
+	}
 } // namespace hyperion::utils::test
@@ -2,6 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "HyperionUtils/RingBuffer.h"
 
 namespace hyperion::utils::test {
@@ -430,6 +437,632 @@ namespace hyperion::utils::test {
 		ASSERT_EQ(buffer.at(startEraseIndex), valToCompare);
 		ASSERT_EQ(iter, buffer.begin() + startEraseIndex);
 	}
+
+	TEST(RingBufferTest, powerOfTwoCapacity) {
+		using Buffer = RingBuffer<int,
+								  RingBufferType::NotThreadSafe,
+								  std::allocator,
+								  RingBufferCapacity::PowerOfTwo>;
+		auto buffer = Buffer(10U);
+		ASSERT_EQ(buffer.capacity(), 16ULL);
+		ASSERT_TRUE(buffer.empty());
+
+		for(auto i = 0; i < 20; ++i) {
+			buffer.push_back(i);
+		}
+		ASSERT_TRUE(buffer.full());
+		ASSERT_EQ(buffer.size(), 16ULL);
+		ASSERT_EQ(buffer.front(), 4);
+		ASSERT_EQ(buffer.back(), 19);
+		for(auto i = 0ULL; i < buffer.size(); ++i) {
+			ASSERT_EQ(buffer.at(i), static_cast<int>(i) + 4);
+		}
+
+		// `begin()` and `end()` share a slot when full, but still compare unequal
+		auto expected = 4;
+		for(auto value : buffer) {
+			ASSERT_EQ(value, expected++);
+		}
+		ASSERT_EQ(expected, 20);
+
+		ASSERT_EQ(buffer.pop_front(), 4);
+		ASSERT_EQ(buffer.pop_back(), 19);
+		ASSERT_EQ(buffer.size(), 14ULL);
+
+		buffer.reserve(20U);
+		ASSERT_EQ(buffer.capacity(), 32ULL);
+		ASSERT_EQ(buffer.size(), 14ULL);
+		ASSERT_EQ(buffer.front(), 5);
+		ASSERT_EQ(buffer.back(), 18);
+	}
+
+	TEST(RingBufferTest, asSpans) {
+		auto buffer = RingBuffer<int, RingBufferType::NotThreadSafe>(8U);
+		ASSERT_EQ(buffer.as_spans().size(), 0_usize);
+
+		for(auto i = 0; i < 5; ++i) {
+			buffer.push_back(i);
+		}
+		auto spans = buffer.as_spans();
+		ASSERT_EQ(spans.first.size(), 5_usize);
+		ASSERT_EQ(spans.second.size(), 0_usize);
+		ASSERT_EQ(spans.first.data(), &buffer.front());
+
+		// wrap the elements around the end of the storage
+		for(auto i = 5; i < 12; ++i) {
+			buffer.push_back(i);
+		}
+		spans = buffer.as_spans();
+		ASSERT_EQ(spans.size(), buffer.size());
+		ASSERT_NE(spans.second.size(), 0_usize);
+		ASSERT_EQ(spans.first.data(), &buffer.front());
+		ASSERT_EQ(&spans.second.data()[spans.second.size() - 1], &buffer.back()); // NOLINT
+
+		auto values = std::vector<int>();
+		buffer.for_each_segment([&values](Span<int> segment) {
+			values.insert(values.end(), segment.begin(), segment.end());
+		});
+		ASSERT_EQ(values, std::vector<int>({4, 5, 6, 7, 8, 9, 10, 11}));
+
+		const auto& const_buffer = buffer;
+		auto sum = 0;
+		auto num_segments = 0_usize;
+		const_buffer.for_each_segment([&](Span<const int> segment) {
+			++num_segments;
+			for(const auto value : segment) {
+				sum += value;
+			}
+		});
+		ASSERT_EQ(num_segments, 2_usize);
+		ASSERT_EQ(sum, 60);
+	}
+
+	TEST(RingBufferTest, asSpansPowerOfTwo) {
+		auto buffer = RingBuffer<int,
+								 RingBufferType::NotThreadSafe,
+								 std::allocator,
+								 RingBufferCapacity::PowerOfTwo>(8U);
+		for(auto i = 0; i < 11; ++i) {
+			buffer.push_back(i);
+		}
+
+		auto spans = buffer.as_spans();
+		ASSERT_EQ(spans.first.size(), 5_usize);
+		ASSERT_EQ(spans.second.size(), 3_usize);
+		ASSERT_EQ(spans.first[0], 3);
+		ASSERT_EQ(spans.second[2], 10);
+	}
+
+	TEST(RingBufferTest, pushBackNAndPopFrontN) {
+		auto buffer = RingBuffer<int, RingBufferType::NotThreadSafe>(8U);
+		const auto values = std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+
+		buffer.push_back_n(Span<const int>::make_span(values.data(), 5));
+		ASSERT_EQ(buffer.size(), 5_usize);
+		auto destination = std::array<int, 8>();
+		ASSERT_EQ(buffer.pop_front_n(Span<int>::make_span(destination.data(), 3)), 3_usize);
+		ASSERT_EQ(destination[0], 0);
+		ASSERT_EQ(destination[2], 2);
+		ASSERT_EQ(buffer.front(), 3);
+
+		// wraps around the end of the storage, and overwrites the front
+		buffer.push_back_n(Span<const int>::make_span(values.data() + 5, 7)); // NOLINT
+		ASSERT_TRUE(buffer.full());
+		ASSERT_EQ(buffer.front(), 4);
+		ASSERT_EQ(buffer.back(), 11);
+
+		ASSERT_EQ(buffer.pop_front_n(Span<int>::make_span(destination.data(), destination.size())),
+				  8_usize);
+		for(auto i = 0_usize; i < 8_usize; ++i) {
+			ASSERT_EQ(destination[i], static_cast<int>(i) + 4); // NOLINT
+		}
+		ASSERT_TRUE(buffer.empty());
+
+		// more than fit only keeps the last `capacity()`
+		buffer.push_back_n(Span<const int>::make_span(values.data(), values.size()));
+		ASSERT_EQ(buffer.front(), 4);
+		ASSERT_EQ(buffer.back(), 11);
+		ASSERT_EQ(buffer.discard_front(3_usize), 3_usize);
+		ASSERT_EQ(buffer.front(), 7);
+		ASSERT_EQ(buffer.discard_front(10_usize), 5_usize);
+		ASSERT_TRUE(buffer.empty());
+	}
+
+	TEST(RingBufferTest, pushBackNPowerOfTwo) {
+		auto buffer = RingBuffer<int,
+								 RingBufferType::NotThreadSafe,
+								 std::allocator,
+								 RingBufferCapacity::PowerOfTwo>(8U);
+		const auto values = std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+		buffer.push_back_n(Span<const int>::make_span(values.data(), 6));
+		ASSERT_EQ(buffer.discard_front(4_usize), 4_usize);
+		buffer.push_back_n(Span<const int>::make_span(values.data() + 6, 6)); // NOLINT
+		ASSERT_EQ(buffer.size(), 8_usize);
+		for(auto i = 0_usize; i < buffer.size(); ++i) {
+			ASSERT_EQ(buffer.at(i), static_cast<int>(i) + 4);
+		}
+	}
+
+	TEST(RingBufferTest, append) {
+		auto buffer = RingBuffer<std::string, RingBufferType::NotThreadSafe>(4U);
+		buffer.append(std::vector<std::string>({"a", "b"}));
+		buffer.append(std::list<std::string>({"c", "d", "e"}));
+		ASSERT_EQ(buffer.size(), 4_usize);
+		ASSERT_EQ(buffer.front(), "b"s);
+		ASSERT_EQ(buffer.back(), "e"s);
+
+		auto moved = std::vector<std::string>({"f"});
+		buffer.append(std::move(moved));
+		ASSERT_EQ(buffer.back(), "f"s);
+	}
+
+	/// @brief Counts its live instances and constructions, and isn't default constructible
+	struct Tracked {
+		static inline i64 s_num_live = 0;		 // NOLINT
+		static inline i64 s_num_constructed = 0; // NOLINT
+
+		explicit Tracked(int val) noexcept : value(val) {
+			++s_num_live;
+			++s_num_constructed;
+		}
+		Tracked(const Tracked& tracked) noexcept : value(tracked.value) {
+			++s_num_live;
+			++s_num_constructed;
+		}
+		Tracked(Tracked&& tracked) noexcept : value(tracked.value) {
+			++s_num_live;
+			++s_num_constructed;
+		}
+		~Tracked() noexcept {
+			--s_num_live;
+		}
+
+		auto operator=(const Tracked& tracked) noexcept -> Tracked& = default;
+		auto operator=(Tracked&& tracked) noexcept -> Tracked& = default;
+
+		int value;
+	};
+
+	template<RingBufferCapacity CapacityPolicy>
+	auto check_only_live_elements_are_constructed() -> void {
+		using Buffer
+			= RingBuffer<Tracked, RingBufferType::NotThreadSafe, std::allocator, CapacityPolicy>;
+		Tracked::s_num_live = 0;
+		{
+			auto buffer = Buffer(8U);
+			ASSERT_EQ(Tracked::s_num_live, 0);
+
+			for(auto i = 0; i < 12; ++i) {
+				buffer.emplace_back(i);
+			}
+			ASSERT_EQ(Tracked::s_num_live, 8);
+			ASSERT_EQ(buffer.front().value, 4);
+
+			ASSERT_EQ(buffer.pop_front().value, 4);
+			ASSERT_EQ(buffer.pop_back().value, 11);
+			ASSERT_EQ(Tracked::s_num_live, 6);
+
+			buffer.insert(buffer.begin() + 1, Tracked(100));
+			buffer.insert(buffer.begin(), Tracked(101));
+			ASSERT_EQ(Tracked::s_num_live, 8);
+			// full, so inserting drops the last element
+			buffer.insert(buffer.begin(), Tracked(102));
+			ASSERT_EQ(Tracked::s_num_live, 8);
+			ASSERT_EQ(buffer.at(2).value, 5);
+			ASSERT_EQ(buffer.back().value, 9);
+
+			ignore(buffer.erase(buffer.begin() + 1, buffer.begin() + 4));
+			ASSERT_EQ(Tracked::s_num_live, 5);
+			ignore(buffer.erase(buffer.begin()));
+			ASSERT_EQ(Tracked::s_num_live, 4);
+
+			const auto values = std::vector<Tracked>({Tracked(200), Tracked(201), Tracked(202)});
+			buffer.push_back_n(Span<const Tracked>::make_span(values.data(), values.size()));
+			buffer.push_back_n(Span<const Tracked>::make_span(values.data(), values.size()));
+			ASSERT_EQ(Tracked::s_num_live, 8 + 3);
+			ASSERT_EQ(buffer.back().value, 202);
+
+			auto destination = std::vector<Tracked>(3, Tracked(0));
+			ASSERT_EQ(buffer.pop_front_n(Span<Tracked>::make_span(destination.data(), 3)), 3U);
+			ASSERT_EQ(buffer.discard_front(2U), 2U);
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3);
+
+			buffer.reserve(32U);
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3);
+
+			auto copy = buffer;
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3 + 3);
+			copy = buffer;
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3 + 3);
+			auto moved = std::move(copy);
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3 + 3);
+			moved.clear();
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3);
+		}
+		ASSERT_EQ(Tracked::s_num_live, 0);
+	}
+
+	TEST(RingBufferTest, onlyLiveElementsAreConstructed) {
+		check_only_live_elements_are_constructed<RingBufferCapacity::Exact>();
+		check_only_live_elements_are_constructed<RingBufferCapacity::PowerOfTwo>();
+	}
+
+	template<RingBufferCapacity CapacityPolicy>
+	auto check_push_back_n_assigns_over_live_elements() -> void {
+		using Buffer
+			= RingBuffer<Tracked, RingBufferType::NotThreadSafe, std::allocator, CapacityPolicy>;
+		Tracked::s_num_live = 0;
+		{
+			auto buffer = Buffer(4U);
+			for(auto i = 0; i < 4; ++i) {
+				buffer.emplace_back(i);
+			}
+			const auto values = std::vector<Tracked>({Tracked(200), Tracked(201), Tracked(202)});
+
+			// full, so the new elements wrap around onto live ones, which are assigned over
+			// instead of being destroyed and constructed again
+			Tracked::s_num_constructed = 0;
+			buffer.push_back_n(Span<const Tracked>::make_span(values.data(), values.size()));
+			ASSERT_LE(Tracked::s_num_constructed, 1);
+			ASSERT_EQ(Tracked::s_num_live, 4 + 3);
+			ASSERT_EQ(buffer.size(), 4_usize);
+			ASSERT_EQ(buffer.front().value, 3);
+			ASSERT_EQ(buffer.back().value, 202);
+		}
+		ASSERT_EQ(Tracked::s_num_live, 0);
+	}
+
+	TEST(RingBufferTest, pushBackNAssignsOverLiveElements) {
+		check_push_back_n_assigns_over_live_elements<RingBufferCapacity::Exact>();
+		check_push_back_n_assigns_over_live_elements<RingBufferCapacity::PowerOfTwo>();
+	}
+
+	template<RingBufferCapacity CapacityPolicy>
+	auto check_elements_of_the_buffer_can_be_pushed() -> void {
+		using Buffer = RingBuffer<std::string,
+								  RingBufferType::NotThreadSafe,
+								  std::allocator,
+								  CapacityPolicy>;
+		auto buffer = Buffer(2U);
+		buffer.push_back("a long string that isn't stored inline: a"s);
+		buffer.push_back("a long string that isn't stored inline: b"s);
+		// full, so this replaces the element it copies
+		buffer.push_back(buffer.front());
+		ASSERT_EQ(buffer.front(), "a long string that isn't stored inline: b"s);
+		ASSERT_EQ(buffer.back(), "a long string that isn't stored inline: a"s);
+
+		buffer.push_back_n(Span<const std::string>::make_span(&buffer.front(), 1U));
+		ASSERT_EQ(buffer.front(), "a long string that isn't stored inline: a"s);
+		ASSERT_EQ(buffer.back(), "a long string that isn't stored inline: b"s);
+
+		buffer.emplace(buffer.begin(), buffer.front());
+		ASSERT_EQ(buffer.front(), "a long string that isn't stored inline: a"s);
+		buffer.insert(buffer.begin(), buffer.back());
+		ASSERT_EQ(buffer.front(), "a long string that isn't stored inline: b"s);
+		ASSERT_EQ(buffer.back(), "a long string that isn't stored inline: a"s);
+
+		ASSERT_EQ(buffer.pop_back(), "a long string that isn't stored inline: a"s);
+		buffer.emplace(buffer.end(), "c");
+		ASSERT_EQ(buffer.size(), 2_usize);
+		ASSERT_EQ(buffer.back(), "c"s);
+	}
+
+	TEST(RingBufferTest, elementsOfTheBufferCanBePushed) {
+		check_elements_of_the_buffer_can_be_pushed<RingBufferCapacity::Exact>();
+		check_elements_of_the_buffer_can_be_pushed<RingBufferCapacity::PowerOfTwo>();
+	}
+
+	TEST(RingBufferTest, powerOfTwoMatchesExact) {
+		constexpr auto capacity = 16U;
+		auto exact = RingBuffer<int, RingBufferType::NotThreadSafe>(capacity);
+		auto power_of_two = RingBuffer<int,
+									   RingBufferType::NotThreadSafe,
+									   std::allocator,
+									   RingBufferCapacity::PowerOfTwo>(capacity);
+		ASSERT_EQ(exact.capacity(), power_of_two.capacity());
+
+		// the same pseudo-random sequence of operations should leave both with the same elements
+		auto state = 12345U;
+		const auto next = [&state](u32 bound) {
+			state = state * 1103515245U + 12345U;
+			return (state >> 16U) % bound;
+		};
+		for(auto step = 0; step < 2000; ++step) {
+			const auto value = static_cast<int>(step);
+			const auto size = static_cast<u32>(exact.size());
+			switch(next(6U)) {
+				case 0:
+				case 1:
+					exact.push_back(value);
+					power_of_two.push_back(value);
+					break;
+				case 2:
+					if(size != 0U) {
+						ASSERT_EQ(exact.pop_front(), power_of_two.pop_front());
+					}
+					break;
+				case 3:
+					if(size != 0U) {
+						ASSERT_EQ(exact.pop_back(), power_of_two.pop_back());
+					}
+					break;
+				case 4:
+					if(size != 0U) {
+						const auto index = next(size);
+						exact.insert(exact.begin() + index, value);
+						power_of_two.insert(power_of_two.begin() + index, value);
+					}
+					break;
+				default:
+					if(size != 0U) {
+						const auto first = next(size);
+						const auto last = first + next(size - first) + 1U;
+						exact.erase(exact.begin() + first, exact.begin() + last);
+						power_of_two.erase(power_of_two.begin() + first,
+										   power_of_two.begin() + last);
+					}
+					break;
+			}
+
+			ASSERT_EQ(exact.size(), power_of_two.size());
+			for(auto i = 0ULL; i < exact.size(); ++i) {
+				ASSERT_EQ(exact.at(i), power_of_two.at(i));
+			}
+		}
+	}
+	template<typename T>
+	struct CountingAllocator : public std::allocator<T> {
+		static inline std::atomic<usize> s_num_allocations = 0_usize; // NOLINT
+
+		CountingAllocator() noexcept = default;
+		template<typename U>
+		explicit CountingAllocator(const CountingAllocator<U>& alloc) noexcept // NOLINT
+			: std::allocator<T>(alloc) {
+		}
+
+		[[nodiscard]] auto allocate(usize n) -> T* {
+			s_num_allocations.fetch_add(1_usize);
+			return std::allocator<T>::allocate(n);
+		}
+	};
+
+	TEST(RingBufferTest, threadSafePushBackAndPopFront) {
+		auto buffer = RingBuffer<std::string, RingBufferType::ThreadSafe>();
+		constexpr auto capacity
+			= RingBuffer<std::string, RingBufferType::ThreadSafe>::DEFAULT_CAPACITY;
+		ASSERT_EQ(buffer.capacity(), capacity);
+		ASSERT_TRUE(buffer.empty());
+		ASSERT_TRUE(buffer.pop_front().is_none());
+
+		for(auto i = 0U; i < capacity; ++i) {
+			buffer.push_back(std::to_string(i));
+		}
+		ASSERT_TRUE(buffer.full());
+
+		for(auto i = 0U; i < capacity; ++i) {
+			ASSERT_EQ(buffer.pop_front().unwrap(), std::to_string(i));
+		}
+		ASSERT_TRUE(buffer.empty());
+		ASSERT_TRUE(buffer.pop_back().is_none());
+	}
+
+	TEST(RingBufferTest, threadSafePopFrontN) {
+		auto buffer = RingBuffer<std::string, RingBufferType::ThreadSafe>();
+		constexpr auto capacity
+			= RingBuffer<std::string, RingBufferType::ThreadSafe>::DEFAULT_CAPACITY;
+		auto destination = std::array<std::string, capacity>();
+
+		// loop the buffer so the popped range wraps around the end of the storage
+		for(auto i = 0U; i < capacity + capacity / 2; ++i) {
+			buffer.push_back(std::to_string(i));
+		}
+
+		ASSERT_EQ(buffer.pop_front_n(Span<std::string>::make_span(destination.data(), 4)), 4U);
+		for(auto i = 0U; i < 4U; ++i) {
+			ASSERT_EQ(destination[i], std::to_string(capacity / 2 + i)); // NOLINT
+		}
+
+		const auto remaining = buffer.size();
+		ASSERT_EQ(buffer.pop_front_n(Span<std::string>::make_span(destination.data(),
+																   destination.size())),
+				  remaining);
+		for(auto i = 0U; i < remaining; ++i) {
+			ASSERT_EQ(destination[i], std::to_string(capacity / 2 + 4U + i)); // NOLINT
+		}
+		ASSERT_TRUE(buffer.empty());
+	}
+
+	TEST(RingBufferTest, threadSafePushBackN) {
+		auto buffer = RingBuffer<std::string, RingBufferType::ThreadSafe>(8U);
+		auto values = std::vector<std::string>();
+		for(auto i = 0; i < 12; ++i) {
+			values.push_back(std::to_string(i));
+		}
+
+		buffer.push_back_n(Span<const std::string>::make_span(values.data(), 5));
+		ASSERT_EQ(buffer.size(), 5U);
+		ASSERT_EQ(buffer.discard_front(2U), 2U);
+		ASSERT_EQ(buffer.front(), "2"s);
+
+		// wraps around the end of the storage, and overwrites the front
+		buffer.push_back_n(Span<const std::string>::make_span(values.data() + 5, 7)); // NOLINT
+		ASSERT_EQ(buffer.size(), 8U);
+		for(auto i = 0U; i < 8U; ++i) {
+			ASSERT_EQ(buffer.at(i), std::to_string(i + 4U));
+		}
+
+		buffer.append(std::list<std::string>({"x", "y"}));
+		ASSERT_EQ(buffer.front(), "6"s);
+		ASSERT_EQ(buffer.back(), "y"s);
+		ASSERT_EQ(buffer.discard_front(20U), 8U);
+		ASSERT_TRUE(buffer.empty());
+	}
+
+	TEST(RingBufferTest, threadSafeConcurrentPushBackN) {
+		constexpr auto num_producers = 4;
+		constexpr auto num_batches = 1000;
+		constexpr auto batch_size = 10_usize;
+		auto buffer = RingBuffer<usize, RingBufferType::ThreadSafe>(
+			static_cast<u32>(num_producers * num_batches * batch_size));
+
+		{
+			auto threads = std::vector<std::jthread>();
+			for(auto producer = 0; producer < num_producers; ++producer) {
+				threads.emplace_back([&buffer]() {
+					auto batch = std::array<usize, batch_size>();
+					for(auto i = 0; i < num_batches; ++i) {
+						for(auto j = 0_usize; j < batch_size; ++j) {
+							batch[j] = j + 1_usize; // NOLINT
+						}
+						buffer.push_back_n(Span<const usize>::make_span(batch.data(), batch_size));
+					}
+				});
+			}
+		}
+
+		auto destination = std::array<usize, 64>();
+		auto sum = 0_usize;
+		auto num_popped = 0_usize;
+		for(auto num_read = buffer.pop_front_n(
+				Span<usize>::make_span(destination.data(), destination.size()));
+			num_read != 0U;
+			num_read = buffer.pop_front_n(
+				Span<usize>::make_span(destination.data(), destination.size())))
+		{
+			num_popped += num_read;
+			for(auto i = 0U; i < num_read; ++i) {
+				sum += destination[i]; // NOLINT
+			}
+		}
+		ASSERT_EQ(num_popped, num_producers * num_batches * batch_size);
+		ASSERT_EQ(sum, num_producers * num_batches * (batch_size * (batch_size + 1_usize)) / 2);
+	}
+
+	TEST(RingBufferTest, threadSafePushBackLooping) {
+		auto buffer = RingBuffer<int, RingBufferType::ThreadSafe>();
+		constexpr auto capacity = RingBuffer<int, RingBufferType::ThreadSafe>::DEFAULT_CAPACITY;
+
+		const auto numWrites = static_cast<int>(capacity * 2);
+		for(auto i = 0; i < numWrites; ++i) {
+			buffer.push_back(i);
+		}
+
+		ASSERT_EQ(buffer.size(), capacity);
+		ASSERT_EQ(buffer.front(), numWrites - static_cast<int>(capacity));
+		ASSERT_EQ(buffer.back(), numWrites - 1);
+		ASSERT_EQ(buffer.pop_back().unwrap(), numWrites - 1);
+		ASSERT_EQ(buffer.pop_front().unwrap(), numWrites - static_cast<int>(capacity));
+		ASSERT_EQ(buffer.size(), capacity - 2);
+	}
+
+	TEST(RingBufferTest, threadSafeDoesNotAllocatePerElement) {
+		using Buffer = RingBuffer<std::array<u64, 4>, RingBufferType::ThreadSafe, CountingAllocator>;
+		auto buffer = Buffer(256U);
+		const auto allocations = CountingAllocator<Buffer::Slot>::s_num_allocations.load();
+
+		for(auto i = 0_u64; i < 256_u64; ++i) {
+			buffer.push_back({i, i, i, i});
+			if(i % 2 == 0) {
+				ASSERT_EQ(buffer.pop_front().unwrap()[0], i / 2);
+			}
+		}
+		ASSERT_EQ(CountingAllocator<Buffer::Slot>::s_num_allocations.load(), allocations);
+	}
+
+	TEST(RingBufferTest, threadSafeOnlyLiveElementsAreConstructed) {
+		using Buffer = RingBuffer<Tracked, RingBufferType::ThreadSafe>;
+		Tracked::s_num_live = 0;
+		{
+			auto buffer = Buffer(8U);
+			ASSERT_EQ(Tracked::s_num_live, 0);
+
+			for(auto i = 0; i < 12; ++i) {
+				buffer.emplace_back(i);
+			}
+			ASSERT_EQ(Tracked::s_num_live, 8);
+			ASSERT_EQ(buffer.front().value, 4);
+
+			ASSERT_EQ(buffer.pop_front().unwrap().value, 4);
+			ASSERT_EQ(buffer.pop_back().unwrap().value, 11);
+			ASSERT_EQ(Tracked::s_num_live, 6);
+
+			buffer.insert(buffer.begin() + 1, Tracked(100));
+			buffer.insert(buffer.begin(), Tracked(101));
+			ASSERT_EQ(Tracked::s_num_live, 8);
+			// full, so inserting drops the last element
+			buffer.insert(buffer.begin(), Tracked(102));
+			ASSERT_EQ(Tracked::s_num_live, 8);
+			ASSERT_EQ(buffer.at(2).value, 5);
+			ASSERT_EQ(buffer.back().value, 9);
+
+			ignore(buffer.erase(buffer.begin() + 1, buffer.begin() + 4));
+			ASSERT_EQ(Tracked::s_num_live, 5);
+			ignore(buffer.erase(buffer.begin()));
+			ASSERT_EQ(Tracked::s_num_live, 4);
+			ASSERT_EQ(buffer.front().value, 6);
+
+			// the second push wraps around onto the front, dropping two elements
+			const auto values = std::vector<Tracked>({Tracked(200), Tracked(201), Tracked(202)});
+			buffer.push_back_n(Span<const Tracked>::make_span(values.data(), values.size()));
+			buffer.push_back_n(Span<const Tracked>::make_span(values.data(), values.size()));
+			ASSERT_EQ(Tracked::s_num_live, 8 + 3);
+			ASSERT_EQ(buffer.front().value, 8);
+			ASSERT_EQ(buffer.back().value, 202);
+
+			auto destination = std::vector<Tracked>(3, Tracked(0));
+			ASSERT_EQ(buffer.pop_front_n(Span<Tracked>::make_span(destination.data(), 3)), 3U);
+			ASSERT_EQ(buffer.discard_front(2U), 2U);
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3);
+
+			buffer.reserve(32U);
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3);
+			ASSERT_EQ(buffer.front().value, 200);
+
+			auto copy = buffer;
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3 + 3);
+			copy = buffer;
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3 + 3);
+			auto moved = std::move(copy);
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3 + 3);
+			moved.clear();
+			ASSERT_EQ(Tracked::s_num_live, 3 + 3 + 3);
+		}
+		ASSERT_EQ(Tracked::s_num_live, 0);
+	}
+
+	TEST(RingBufferTest, threadSafeConcurrentPushBackAndPopFront) {
+		constexpr auto num_producers = 4;
+		constexpr auto num_per_producer = 10000;
+		auto buffer = RingBuffer<usize, RingBufferType::ThreadSafe>(
+			static_cast<u32>(num_producers * num_per_producer));
+		auto num_popped = std::atomic<usize>(0_usize);
+		auto sum_popped = std::atomic<usize>(0_usize);
+
+		{
+			auto threads = std::vector<std::jthread>();
+			for(auto producer = 0; producer < num_producers; ++producer) {
+				threads.emplace_back([&buffer]() {
+					for(auto i = 1_usize; i <= num_per_producer; ++i) {
+						buffer.push_back(i);
+					}
+				});
+				threads.emplace_back([&]() {
+					while(num_popped.load() < num_producers * num_per_producer) {
+						if(auto value = buffer.pop_front()) {
+							sum_popped.fetch_add(value.unwrap());
+							num_popped.fetch_add(1_usize);
+						}
+					}
+				});
+			}
+		}
+
+		constexpr auto expected_sum
+			= num_producers * (num_per_producer * (num_per_producer + 1_usize)) / 2;
+		ASSERT_EQ(num_popped.load(), num_producers * num_per_producer);
+		ASSERT_EQ(sum_popped.load(), expected_sum);
+		ASSERT_TRUE(buffer.empty());
+	}
 	//
 	// TEST(RingBufferTest, popBack) {
 	//	auto buffer = RingBuffer<int, RingBufferType::NotThreadSafe>();
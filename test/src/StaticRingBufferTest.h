@@ -0,0 +1,145 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "HyperionUtils/StaticRingBuffer.h"
+
+namespace hyperion::utils::test {
+
+	static_assert(std::random_access_iterator<StaticRingBuffer<int, 4>::Iterator>);
+	static_assert(std::random_access_iterator<StaticRingBuffer<int, 4>::ConstIterator>);
+
+	// usable in constant expressions
+	static_assert([]() {
+		auto buffer = StaticRingBuffer<int, 4>();
+		for(auto i = 0; i < 6; ++i) {
+			buffer.push_back(i);
+		}
+		auto sum = 0;
+		for(const auto value : buffer) {
+			sum += value;
+		}
+		return sum + buffer.pop_front() * 100 + static_cast<int>(buffer.size()) * 1000;
+	}() == 2 + 3 + 4 + 5 + 200 + 3000);
+
+	TEST(StaticRingBufferTest, pushAndPop) {
+		auto buffer = StaticRingBuffer<std::string, 3>();
+		ASSERT_TRUE(buffer.empty());
+		ASSERT_EQ(buffer.capacity(), 3_usize);
+
+		buffer.push_back("a");
+		buffer.emplace_back("bb");
+		ASSERT_EQ(buffer.size(), 2_usize);
+		ASSERT_EQ(buffer.front(), "a");
+		ASSERT_EQ(buffer.back(), "bb");
+
+		// overwrites the front once full
+		buffer.push_back("c");
+		buffer.push_back("d");
+		ASSERT_TRUE(buffer.full());
+		ASSERT_EQ(buffer.front(), "bb");
+		ASSERT_EQ(buffer.at(2_usize), "d");
+		ASSERT_EQ(buffer.at(10_usize), "d");
+
+		ASSERT_EQ(buffer.pop_back(), "d");
+		ASSERT_EQ(buffer.pop_front(), "bb");
+		ASSERT_EQ(buffer.size(), 1_usize);
+		ASSERT_EQ(buffer[0_usize], "c");
+
+		buffer.clear();
+		ASSERT_TRUE(buffer.empty());
+	}
+
+	TEST(StaticRingBufferTest, iterators) {
+		auto buffer = StaticRingBuffer<int, 5>();
+		for(auto i = 0; i < 8; ++i) {
+			buffer.push_back(i);
+		}
+
+		ASSERT_EQ(std::distance(buffer.begin(), buffer.end()), 5);
+		ASSERT_EQ(std::accumulate(buffer.begin(), buffer.end(), 0), 3 + 4 + 5 + 6 + 7);
+		ASSERT_EQ(*(buffer.begin() + 2), 5);
+		ASSERT_EQ(buffer.end()[-1], 7);
+
+		std::sort(buffer.begin(), buffer.end(), std::greater<>());
+		ASSERT_EQ(buffer.front(), 7);
+		ASSERT_EQ(buffer.back(), 3);
+
+		const auto& const_buffer = buffer;
+		ASSERT_TRUE(std::is_sorted(const_buffer.begin(), const_buffer.end(), std::greater<>()));
+	}
+
+	TEST(StaticRingBufferTest, bulkOperations) {
+		auto buffer = StaticRingBuffer<int, 8>();
+		const auto values = std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+
+		buffer.push_back_n(Span<const int>::make_span(values.data(), 5));
+		ASSERT_EQ(buffer.discard_front(3_usize), 3_usize);
+		// wraps around the end of the storage, and overwrites the front
+		buffer.push_back_n(Span<const int>::make_span(values.data() + 5, 7)); // NOLINT
+		ASSERT_TRUE(buffer.full());
+
+		auto spans = buffer.as_spans();
+		ASSERT_EQ(spans.size(), 8_usize);
+		ASSERT_EQ(spans.first.size(), 4_usize);
+		ASSERT_EQ(spans.first[0], 4);
+		ASSERT_EQ(spans.second[0], 8);
+
+		auto destination = std::array<int, 16>();
+		ASSERT_EQ(buffer.pop_front_n(Span<int>::make_span(destination.data(), destination.size())),
+				  8_usize);
+		for(auto i = 0_usize; i < 8_usize; ++i) {
+			ASSERT_EQ(destination[i], static_cast<int>(i) + 4); // NOLINT
+		}
+		ASSERT_TRUE(buffer.empty());
+
+		buffer.append(std::list<int>({1, 2, 3}));
+		ASSERT_EQ(buffer.size(), 3_usize);
+		ASSERT_EQ(buffer.back(), 3);
+	}
+
+	TEST(StaticRingBufferTest, pushBackNFromItself) {
+		auto buffer = StaticRingBuffer<std::string, 4>();
+		for(auto i = 0; i < 5; ++i) {
+			buffer.push_back(std::to_string(i));
+		}
+		ASSERT_EQ(buffer.as_spans().second.size(), 1_usize);
+
+		// the last element is in the first slot of the storage, so these are the elements
+		// ["4", "1", "2"], and copying them in place would overwrite the "1" and "2" before
+		// they're read
+		const auto* storage = &buffer.at(3_usize);
+		buffer.push_back_n(Span<const std::string>::make_span(storage, 3_usize));
+
+		ASSERT_EQ(buffer.size(), 4_usize);
+		ASSERT_EQ(buffer[0_usize], "4");
+		ASSERT_EQ(buffer[1_usize], "4");
+		ASSERT_EQ(buffer[2_usize], "1");
+		ASSERT_EQ(buffer[3_usize], "2");
+	}
+
+	TEST(StaticRingBufferTest, atOnEmpty) {
+		auto buffer = StaticRingBuffer<int, 4>();
+		// out of bounds on an empty buffer returns its front slot, instead of reading past the
+		// end of the storage
+		ASSERT_EQ(&buffer.at(100_usize), &buffer.at(0_usize));
+
+		buffer.push_back(1);
+		buffer.push_back(2);
+		std::ignore = buffer.pop_front();
+		std::ignore = buffer.pop_front();
+		ASSERT_TRUE(buffer.empty());
+		const auto& const_buffer = buffer;
+		ASSERT_EQ(&const_buffer.at(100_usize), &const_buffer.at(0_usize));
+		ASSERT_EQ(&buffer.at(0_usize), &buffer.as_spans().first.data()[0]); // NOLINT
+	}
+} // namespace hyperion::utils::test
@@ -1,10 +1,12 @@
 #include <gtest/gtest.h>
 
 #include "ChangeDetectorTest.h"
+#include "LockFreeQueueTest.h"
 #include "LoggerTest.h"
 #include "OptionTest.h"
 #include "ResultTest.h"
 #include "RingBufferTest.h"
+#include "StaticRingBufferTest.h"
 
 auto main(int argc, char** argv) noexcept -> int {
 	testing::InitGoogleTest(&argc, argv);
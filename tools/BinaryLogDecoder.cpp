@@ -0,0 +1,80 @@
+/// @brief Command line tool that decodes a log written by `BinaryFileSink` into text
+///
+/// Usage: HyperionBinaryLogDecoder <binary log> [output file] [--precision=s|ms|us]
+///
+/// The decoded entries are written to the output file if one is given, or stdout otherwise
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../include/HyperionUtils/logging/BinaryLog.h"
+
+using hyperion::LogTimeStampPrecision;
+
+namespace {
+	[[nodiscard]] auto decode(LogTimeStampPrecision precision,
+							  std::string_view data,
+							  fmt::memory_buffer& output) noexcept {
+		switch(precision) {
+			case LogTimeStampPrecision::Milliseconds:
+				return hyperion::binary_log::decode<LogTimeStampPrecision::Milliseconds>(data,
+																						 output);
+			case LogTimeStampPrecision::Microseconds:
+				return hyperion::binary_log::decode<LogTimeStampPrecision::Microseconds>(data,
+																						 output);
+			default: return hyperion::binary_log::decode(data, output);
+		}
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	const auto args = std::vector<std::string_view>(argv + 1, argv + argc); // NOLINT
+	auto paths = std::vector<std::string_view>();
+	auto precision = LogTimeStampPrecision::Seconds;
+	for(const auto arg : args) {
+		if(arg == "--precision=ms") {
+			precision = LogTimeStampPrecision::Milliseconds;
+		}
+		else if(arg == "--precision=us") {
+			precision = LogTimeStampPrecision::Microseconds;
+		}
+		else if(arg != "--precision=s") {
+			paths.push_back(arg);
+		}
+	}
+
+	if(paths.empty() || paths.size() > 2) {
+		fmt::print(stderr,
+				   "Usage: {} <binary log> [output file] [--precision=s|ms|us]\n",
+				   argc > 0 ? argv[0] : "HyperionBinaryLogDecoder"); // NOLINT
+		return 1;
+	}
+
+	auto input = std::ifstream(std::string(paths[0]), std::ios::binary);
+	if(!input) {
+		fmt::print(stderr, "Error opening {}\n", paths[0]);
+		return 1;
+	}
+	const auto data
+		= std::string(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+
+	auto output = fmt::memory_buffer();
+	auto result = decode(precision, data, output);
+	const auto text = std::string_view(output.data(), output.size());
+	if(paths.size() == 2) {
+		auto file = fmt::output_file(std::string(paths[1]));
+		file.print("{}", text);
+	}
+	else {
+		fmt::print("{}", text);
+	}
+
+	if(result.is_err()) {
+		fmt::print(stderr, "{}\n", result.unwrap_err().message());
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,250 @@
+/// @brief Benchmark of `LockFreeQueue` throughput under contention
+///
+/// Usage: HyperionLockFreeQueueBenchmark [max threads] [operations per thread]
+///
+/// For 1, 2, 4, ... up to `max threads` threads (32 by default), every thread repeatedly pushes
+/// an entry onto a shared queue and then reads one back, so every thread is both a producer and
+/// a consumer and contends on both ends of the queue. This is done for a queue backed by the
+/// thread-safe `RingBuffer` and for the multi-producer, multi-consumer queue, and the total
+/// operations per second and average time per operation of each are printed.
+///
+/// Then, for every `QueueConcurrency`, fills a queue and drains it from a single thread, once
+/// entry by entry with `read` and once in batches with `read_n`, which claims each batch with a
+/// single update of the read position, and prints the average time per entry read.
+///
+/// Finally, measures the enqueue latency with one producer and one consumer, as in a `Logger`
+/// with a single logging thread. The consumer drains the queue with `read_n` while the producer
+/// waits for room for a batch of entries, then times pushing them. The percentiles of the
+/// average time per push in each batch are printed for every `QueueConcurrency`
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "../include/HyperionUtils/LockFreeQueue.h"
+#include "../include/HyperionUtils/logging/fmtIncludes.h"
+
+using hyperion::u64;
+using hyperion::usize;
+
+namespace {
+	/// @brief Large enough that the threads never fill the queue
+	constexpr usize QUEUE_CAPACITY = 1024;
+
+	[[nodiscard]] auto parse(std::string_view arg, u64 default_value) noexcept -> u64 {
+		auto value = default_value;
+		std::from_chars(arg.data(), arg.data() + arg.size(), value); // NOLINT
+		return value;
+	}
+
+	/// @brief Runs `function` on `num_threads` threads at once, returning how long it took for
+	/// all of them to finish
+	template<typename Function>
+	[[nodiscard]] auto
+	time_threads(usize num_threads, Function&& function) -> std::chrono::nanoseconds {
+		auto ready = std::atomic<usize>(0);
+		auto start = std::atomic<bool>(false);
+		auto began = std::chrono::steady_clock::time_point();
+		{
+			auto threads = std::vector<std::jthread>();
+			for(auto thread = usize(0); thread < num_threads; ++thread) {
+				threads.emplace_back([&]() {
+					ready.fetch_add(1, std::memory_order_acq_rel);
+					while(!start.load(std::memory_order_acquire)) {
+						std::this_thread::yield();
+					}
+					function();
+				});
+			}
+			while(ready.load(std::memory_order_acquire) != num_threads) {
+				std::this_thread::yield();
+			}
+			began = std::chrono::steady_clock::now();
+			start.store(true, std::memory_order_release);
+		}
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - began);
+	}
+
+	template<hyperion::QueueConcurrency Concurrency>
+	auto benchmark_throughput(std::string_view name, usize num_threads, u64 operations) -> void {
+		using Queue = hyperion::LockFreeQueue<u64,
+											  hyperion::QueuePolicy::ErrWhenFull,
+											  QUEUE_CAPACITY,
+											  Concurrency>;
+		// the multi-producer, multi-consumer queue stores its slots inline, so keep it off the
+		// stack
+		auto queue = std::make_unique<Queue>();
+
+		const auto elapsed = time_threads(num_threads, [&queue, operations]() {
+			for(auto i = u64(0); i < operations; ++i) {
+				while(queue->push(i).is_err()) {
+					std::this_thread::yield();
+				}
+				while(queue->read().is_err()) {
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		const auto total_operations
+			= static_cast<double>(operations * static_cast<u64>(num_threads) * 2);
+		const auto seconds = static_cast<double>(elapsed.count()) / 1.0e9;
+		fmt::print("{:<12} threads {:<4} {:>8.2f}M operations/s  {:.3f}ns/operation\n",
+				   name,
+				   num_threads,
+				   total_operations / seconds / 1.0e6,
+				   static_cast<double>(elapsed.count()) / total_operations);
+	}
+
+	[[nodiscard]] auto percentile(const std::vector<double>& sorted, double fraction) noexcept
+		-> double {
+		const auto index = static_cast<usize>(fraction * static_cast<double>(sorted.size() - 1));
+		return sorted[index];
+	}
+
+	template<hyperion::QueueConcurrency Concurrency>
+	auto benchmark_reads(std::string_view name, usize batch_size, u64 iterations) -> void {
+		using Queue = hyperion::LockFreeQueue<u64,
+											  hyperion::QueuePolicy::ErrWhenFull,
+											  QUEUE_CAPACITY,
+											  Concurrency>;
+		auto queue = std::make_unique<Queue>();
+		auto batch = std::vector<u64>(batch_size);
+
+		const auto fill = [&queue]() {
+			for(auto i = u64(0); queue->push(i).is_ok(); ++i) {
+			}
+		};
+		// times draining the queue with `read_entries`, filling it back up before each drain
+		const auto time_per_entry = [&](auto&& read_entries) {
+			auto elapsed = std::chrono::nanoseconds(0);
+			auto num_read = u64(0);
+			for(auto i = u64(0); i < iterations; ++i) {
+				fill();
+				const auto start = std::chrono::steady_clock::now();
+				num_read += read_entries();
+				elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - start);
+			}
+			return static_cast<double>(elapsed.count()) / static_cast<double>(num_read);
+		};
+
+		const auto one_by_one = time_per_entry([&queue]() {
+			auto num_read = u64(0);
+			while(queue->read().is_ok()) {
+				++num_read;
+			}
+			return num_read;
+		});
+		const auto batched = time_per_entry([&queue, &batch]() {
+			auto num_read = u64(0);
+			while(const auto read
+				  = queue->read_n(hyperion::Span<u64>::make_span(batch.data(), batch.size())))
+			{
+				num_read += read;
+			}
+			return num_read;
+		});
+
+		fmt::print("{:<12} read {:.3f}ns/entry  read_n (batch {}) {:.3f}ns/entry\n",
+				   name,
+				   one_by_one,
+				   batch_size,
+				   batched);
+	}
+
+	template<hyperion::QueueConcurrency Concurrency>
+	auto benchmark_enqueue_latency(std::string_view name, usize batch_size, u64 num_batches)
+		-> void {
+		using Queue = hyperion::LockFreeQueue<u64,
+											  hyperion::QueuePolicy::ErrWhenFull,
+											  QUEUE_CAPACITY,
+											  Concurrency>;
+		auto queue = std::make_unique<Queue>();
+		// the average nanoseconds per push of each batch
+		auto latencies = std::vector<double>();
+		latencies.reserve(num_batches);
+
+		{
+			auto consumer = std::jthread([&queue, batch_size](const std::stop_token& stop) {
+				auto entries = std::vector<u64>(batch_size);
+				auto sum = u64(0);
+				while(!stop.stop_requested()) {
+					const auto num_read = queue->read_n(
+						hyperion::Span<u64>::make_span(entries.data(), entries.size()));
+					for(auto i = usize(0); i < num_read; ++i) {
+						sum += entries[i];
+					}
+					if(num_read == 0) {
+						std::this_thread::yield();
+					}
+				}
+				// keep the sum observable, so the reads aren't optimized out
+				if(sum == UINT64_MAX) {
+					fmt::print("");
+				}
+			});
+
+			auto value = u64(0);
+			for(auto batch = u64(0); batch < num_batches; ++batch) {
+				while(queue->size() > QUEUE_CAPACITY - batch_size) {
+					std::this_thread::yield();
+				}
+				const auto start = std::chrono::steady_clock::now();
+				for(auto i = usize(0); i < batch_size; ++i) {
+					std::ignore = queue->push(value++).is_ok();
+				}
+				const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - start);
+				latencies.push_back(static_cast<double>(elapsed.count())
+									/ static_cast<double>(batch_size));
+			}
+		}
+
+		std::sort(latencies.begin(), latencies.end());
+		fmt::print("{:<12} enqueue latency (ns/push, batches of {}): p50 {:.3f}  p90 {:.3f}  "
+				   "p99 {:.3f}\n",
+				   name,
+				   batch_size,
+				   percentile(latencies, 0.5),
+				   percentile(latencies, 0.9),
+				   percentile(latencies, 0.99));
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	const auto args = std::vector<std::string_view>(argv + 1, argv + argc); // NOLINT
+	const auto max_threads
+		= std::max(static_cast<usize>(args.size() > 0 ? parse(args[0], 32) : 32), usize(1));
+	const auto operations = args.size() > 1 ? parse(args[1], 100000) : 100000;
+
+	for(auto num_threads = usize(1); num_threads <= max_threads; num_threads *= 2) {
+		benchmark_throughput<hyperion::QueueConcurrency::RingBuffer>("RingBuffer",
+																	 num_threads,
+																	 operations);
+		benchmark_throughput<hyperion::QueueConcurrency::MPMC>("MPMC", num_threads, operations);
+	}
+
+	const auto batch_size = usize(64);
+	const auto read_iterations = std::max(operations / 100, u64(1));
+	benchmark_reads<hyperion::QueueConcurrency::RingBuffer>("RingBuffer",
+															batch_size,
+															read_iterations);
+	benchmark_reads<hyperion::QueueConcurrency::MPMC>("MPMC", batch_size, read_iterations);
+	benchmark_reads<hyperion::QueueConcurrency::SPSC>("SPSC", batch_size, read_iterations);
+
+	const auto num_batches = std::max(operations / batch_size, u64(1));
+	benchmark_enqueue_latency<hyperion::QueueConcurrency::RingBuffer>("RingBuffer",
+																	  batch_size,
+																	  num_batches);
+	benchmark_enqueue_latency<hyperion::QueueConcurrency::MPMC>("MPMC", batch_size, num_batches);
+	benchmark_enqueue_latency<hyperion::QueueConcurrency::SPSC>("SPSC", batch_size, num_batches);
+	return 0;
+}
@@ -0,0 +1,108 @@
+/// @brief Benchmark of the cost of log calls that are filtered out by their level
+///
+/// Usage: HyperionLoggerFilterBenchmark [calls]
+///
+/// Times `HYPERION_LOG_TRACE` calls whose argument builds a string too long for the small string
+/// optimization, against a loop that makes no log call at all, with:
+/// - a `Logger` whose `MINIMUM_LEVEL` is above `LogLevel::TRACE`, so the call is compiled out
+/// - a `Logger` whose `MINIMUM_LEVEL` is `LogLevel::DISABLED`
+/// - a `Logger` whose runtime level, set with `set_level`, is above `LogLevel::TRACE`, so the
+///   call costs a relaxed atomic load
+/// And, for comparison, calling `trace` directly on that last `Logger`, which filters the entry
+/// out with the same load, but only after its arguments have been evaluated.
+///
+/// The average time per call and the number of times the argument was evaluated are printed
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "../include/HyperionUtils/Logger.h"
+
+using hyperion::u64;
+
+namespace {
+	template<hyperion::LogLevel MinimumLevel>
+	using Parameters
+		= hyperion::LoggerParameters<hyperion::LoggerPolicy<hyperion::LogPolicy::DropWhenFull>,
+									 hyperion::LoggerLevel<MinimumLevel>>;
+
+	/// @brief The number of times `make_argument` has been called
+	u64 num_evaluations = 0; // NOLINT
+
+	/// @brief Stored to on every iteration, so the timed loops aren't optimized out
+	volatile u64 iteration_sink = 0; // NOLINT
+
+	[[nodiscard]] auto parse(std::string_view arg, u64 default_value) noexcept -> u64 {
+		auto value = default_value;
+		std::from_chars(arg.data(), arg.data() + arg.size(), value); // NOLINT
+		return value;
+	}
+
+	/// @brief An argument that's expensive to evaluate, like most things worth logging
+	[[nodiscard]] auto make_argument(u64 value) -> std::string {
+		++num_evaluations;
+		return std::string("an argument that is too long for the small string optimization ")
+			   + std::to_string(value);
+	}
+
+	[[nodiscard]] auto make_sinks(const std::string& path) -> hyperion::Sinks {
+		auto sinks = hyperion::Sinks();
+		sinks.push_back(hyperion::make_sink<hyperion::FileSink<>>(
+			std::make_unique<fmt::ostream>(fmt::output_file(path))));
+		return sinks;
+	}
+
+	/// @brief Calls `function` with `0` to `calls - 1`, printing the average time per call and
+	/// how many times the call evaluated `make_argument`
+	template<typename Function>
+	auto benchmark(std::string_view name, u64 calls, Function&& function) -> void {
+		num_evaluations = 0;
+		const auto start = std::chrono::steady_clock::now();
+		for(auto i = u64(0); i < calls; ++i) {
+			function(i);
+			iteration_sink = i;
+		}
+		const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start);
+
+		fmt::print("{:<48} {:.3f}ns/call  {} argument evaluations\n",
+				   name,
+				   static_cast<double>(elapsed.count()) / static_cast<double>(calls),
+				   num_evaluations);
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	const auto args = std::vector<std::string_view>(argv + 1, argv + argc); // NOLINT
+	const auto calls = args.size() > 0 ? parse(args[0], 10000000) : 10000000;
+
+	auto directory = std::filesystem::temp_directory_path();
+	directory.append("Hyperion");
+	std::filesystem::create_directory(directory);
+	const auto path = (directory / "FilterBenchmark.log").string();
+
+	auto compiled_out = hyperion::Logger<Parameters<hyperion::LogLevel::INFO>>(make_sinks(path));
+	auto disabled = hyperion::Logger<Parameters<hyperion::LogLevel::DISABLED>>(make_sinks(path));
+	auto runtime_filtered
+		= hyperion::Logger<Parameters<hyperion::LogLevel::TRACE>>(make_sinks(path));
+	runtime_filtered.set_level(hyperion::LogLevel::ERROR);
+
+	benchmark("no log call", calls, []([[maybe_unused]] u64 i) {});
+	benchmark("HYPERION_LOG_TRACE below MINIMUM_LEVEL", calls, [&compiled_out](u64 i) {
+		HYPERION_LOG_TRACE(compiled_out, hyperion::None(), "{}", make_argument(i));
+	});
+	benchmark("HYPERION_LOG_TRACE with LogLevel::DISABLED", calls, [&disabled](u64 i) {
+		HYPERION_LOG_TRACE(disabled, hyperion::None(), "{}", make_argument(i));
+	});
+	benchmark("HYPERION_LOG_TRACE below the runtime level", calls, [&runtime_filtered](u64 i) {
+		HYPERION_LOG_TRACE(runtime_filtered, hyperion::None(), "{}", make_argument(i));
+	});
+	benchmark("Logger::trace below the runtime level", calls, [&runtime_filtered](u64 i) {
+		std::ignore = runtime_filtered.trace(hyperion::None(), "{}", make_argument(i)).is_ok();
+	});
+	return 0;
+}
@@ -0,0 +1,130 @@
+/// @brief Benchmark of how long logging threads are blocked by a `LogPolicy::FlushWhenFull`
+/// `Logger` whose queue is kept full
+///
+/// Usage: HyperionLoggerOverloadBenchmark [threads] [entries per thread] [--timeout-us=N]
+///
+/// Each thread logs its entries back to back, which is far faster than the `Logger` can write
+/// them, so the queue stays full and every thread spends most of its time blocked in `log`. The
+/// latency of each call is recorded, and the percentiles across every call are printed, along
+/// with the `Logger`'s statistics. With `--timeout-us`, calls give up on their entry after
+/// waiting that long, which bounds the tail latency at the cost of dropped entries
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "../include/HyperionUtils/Logger.h"
+
+using hyperion::u64;
+using hyperion::usize;
+
+namespace {
+	using Parameters = hyperion::LoggerParameters<
+		hyperion::LoggerPolicy<hyperion::LogPolicy::FlushWhenFull>,
+		hyperion::LoggerLevel<hyperion::LogLevel::MESSAGE>>;
+
+	[[nodiscard]] auto parse(std::string_view arg, u64 default_value) noexcept -> u64 {
+		auto value = default_value;
+		std::from_chars(arg.data(), arg.data() + arg.size(), value); // NOLINT
+		return value;
+	}
+
+	[[nodiscard]] auto percentile(const std::vector<u64>& sorted, double fraction) noexcept
+		-> u64 {
+		const auto index = static_cast<usize>(fraction * static_cast<double>(sorted.size() - 1));
+		return sorted[index];
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	const auto args = std::vector<std::string_view>(argv + 1, argv + argc); // NOLINT
+	auto counts = std::vector<u64>();
+	auto timeout = hyperion::Option<std::chrono::nanoseconds>(hyperion::None());
+	for(const auto arg : args) {
+		constexpr auto timeout_flag = std::string_view("--timeout-us=");
+		if(arg.starts_with(timeout_flag)) {
+			timeout = hyperion::Some(std::chrono::nanoseconds(
+				std::chrono::microseconds(parse(arg.substr(timeout_flag.size()), 0))));
+		}
+		else {
+			counts.push_back(parse(arg, 0));
+		}
+	}
+	const auto num_threads = counts.size() > 0 && counts[0] != 0 ? counts[0] : 4;
+	const auto num_entries = counts.size() > 1 && counts[1] != 0 ? counts[1] : 100000;
+
+	auto directory = std::filesystem::temp_directory_path();
+	directory.append("Hyperion");
+	std::filesystem::create_directory(directory);
+	const auto path = (directory / "OverloadBenchmark.log").string();
+
+	// one vector of latencies per thread, so recording them doesn't contend
+	auto latencies = std::vector<std::vector<u64>>(num_threads);
+	auto stats = hyperion::LoggerStats();
+	const auto start = std::chrono::steady_clock::now();
+	{
+		auto sinks = hyperion::Sinks();
+		sinks.push_back(hyperion::make_sink<hyperion::FileSink<>>(
+			std::make_unique<fmt::ostream>(fmt::output_file(path))));
+		auto logger = hyperion::Logger<Parameters>(std::move(sinks));
+		logger.set_flush_timeout(timeout);
+
+		{
+			auto threads = std::vector<std::jthread>();
+			for(auto thread = usize(0); thread < num_threads; ++thread) {
+				threads.emplace_back([&logger, &latencies, thread, num_entries]() {
+					auto& thread_latencies = latencies[thread];
+					thread_latencies.reserve(num_entries);
+					for(auto i = u64(0); i < num_entries; ++i) {
+						const auto before = std::chrono::steady_clock::now();
+						std::ignore = logger.info(hyperion::Some(thread),
+												  "entry {} with some padding to write",
+												  i)
+										  .is_ok();
+						const auto after = std::chrono::steady_clock::now();
+						thread_latencies.push_back(static_cast<u64>(
+							std::chrono::duration_cast<std::chrono::nanoseconds>(after - before)
+								.count()));
+					}
+				});
+			}
+		}
+		stats = logger.stats();
+	}
+	const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - start);
+
+	auto all = std::vector<u64>();
+	for(const auto& thread_latencies : latencies) {
+		all.insert(all.end(), thread_latencies.begin(), thread_latencies.end());
+	}
+	std::sort(all.begin(), all.end());
+
+	const auto timeout_text
+		= timeout.is_some() ?
+				fmt::format("{}us",
+							std::chrono::duration_cast<std::chrono::microseconds>(timeout.unwrap())
+								.count()) :
+				std::string("none");
+	fmt::print("{} threads x {} entries, flush timeout: {}\n",
+			   num_threads,
+			   num_entries,
+			   timeout_text);
+	fmt::print("log latency (ns): p50 {}  p90 {}  p99 {}  p99.9 {}  max {}\n",
+			   percentile(all, 0.5),
+			   percentile(all, 0.9),
+			   percentile(all, 0.99),
+			   percentile(all, 0.999),
+			   all.back());
+	fmt::print("enqueued {}  dropped {}  queue high water mark {}  total {}ms\n",
+			   stats.entries_enqueued,
+			   stats.entries_dropped,
+			   stats.queue_high_water_mark,
+			   elapsed.count());
+	return 0;
+}
@@ -0,0 +1,277 @@
+/// @brief Benchmark of bulk reads and writes of `RingBuffer`s
+///
+/// Usage: HyperionRingBufferBenchmark [capacity] [iterations]
+///
+/// Fills a `RingBuffer` so its elements wrap around the end of its storage, then sums them
+/// repeatedly, once with its `Iterator`s and once over the contiguous segments from
+/// `for_each_segment`, for both `RingBufferCapacity` modes.
+///
+/// Then transfers batches of half the capacity through a `RingBuffer`, once element by element
+/// with `push_back` and `pop_front`, and once with `push_back_n` and `pop_front_n`, for a
+/// trivially copyable and a non-trivial element type, in both `RingBufferType`s.
+///
+/// Finally, creates and destroys `RingBuffer`s of a type that allocates when default
+/// constructed. Neither `RingBufferType` constructs its slots up front, so this should only cost
+/// an allocation of uninitialized storage. The average time per element of each is printed.
+///
+/// Every heap allocation is counted, and the number per element pushed and popped is printed
+/// for both `RingBufferType`s. It should be zero, since elements are stored inline
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../include/HyperionUtils/RingBuffer.h"
+#include "../include/HyperionUtils/logging/fmtIncludes.h"
+
+using hyperion::u64;
+using hyperion::usize;
+
+namespace {
+	/// @brief The number of calls to the global `operator new` so far
+	std::atomic<u64> num_allocations = 0; // NOLINT
+} // namespace
+
+// count every heap allocation, so the benchmarks can report allocations per element
+auto operator new(std::size_t size) -> void* {
+	num_allocations.fetch_add(1, std::memory_order_relaxed);
+	if(auto* memory = std::malloc(size == 0 ? 1 : size)) { // NOLINT
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+// GCC can't tell that `operator new` above returns memory from `std::malloc` once these are
+// inlined into a delete expression, and warns that freeing it is mismatched
+#if defined(__GNUC__) && !defined(__clang__)
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+auto operator delete(void* memory) noexcept -> void {
+	std::free(memory); // NOLINT
+}
+
+auto operator delete(void* memory, [[maybe_unused]] std::size_t size) noexcept -> void {
+	std::free(memory); // NOLINT
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+	#pragma GCC diagnostic pop
+#endif
+
+namespace {
+	[[nodiscard]] auto parse(std::string_view arg, u64 default_value) noexcept -> u64 {
+		auto value = default_value;
+		std::from_chars(arg.data(), arg.data() + arg.size(), value); // NOLINT
+		return value;
+	}
+
+	/// @brief Runs `function` `iterations` times, returning the average nanoseconds per element
+	template<typename Function>
+	[[nodiscard]] auto time_per_element(u64 iterations, usize num_elements, Function&& function)
+		-> double {
+		auto result = u64(0);
+		const auto start = std::chrono::steady_clock::now();
+		for(auto i = u64(0); i < iterations; ++i) {
+			result += function();
+		}
+		const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start);
+		// keep the sums observable, so the loops aren't optimized out
+		if(result == u64(1)) {
+			fmt::print("");
+		}
+		return static_cast<double>(elapsed.count())
+			   / static_cast<double>(iterations * static_cast<u64>(num_elements));
+	}
+
+	template<hyperion::RingBufferCapacity CapacityPolicy>
+	auto benchmark(std::string_view name, usize capacity, u64 iterations) -> void {
+		auto buffer = hyperion::RingBuffer<u64,
+										   hyperion::RingBufferType::NotThreadSafe,
+										   std::allocator,
+										   CapacityPolicy>(capacity);
+		// overfill, so the elements wrap around
+		for(auto i = u64(0); i < buffer.capacity() + buffer.capacity() / 2; ++i) {
+			buffer.push_back(i);
+		}
+
+		const auto iterated = time_per_element(iterations, buffer.size(), [&buffer]() {
+			auto sum = u64(0);
+			for(const auto value : buffer) {
+				sum += value;
+			}
+			return sum;
+		});
+		const auto segmented = time_per_element(iterations, buffer.size(), [&buffer]() {
+			auto sum = u64(0);
+			buffer.for_each_segment([&sum](hyperion::Span<u64> segment) {
+				for(const auto value : segment) {
+					sum += value;
+				}
+			});
+			return sum;
+		});
+
+		fmt::print("{:<12} capacity {:<8} iterator {:.3f}ns/element  for_each_segment "
+				   "{:.3f}ns/element\n",
+				   name,
+				   buffer.capacity(),
+				   iterated,
+				   segmented);
+	}
+
+	template<typename T, hyperion::RingBufferType Type, typename MakeValue>
+	auto benchmark_bulk(std::string_view name,
+						usize capacity,
+						u64 iterations,
+						MakeValue&& make_value) -> void {
+		using Buffer = hyperion::RingBuffer<T, Type>;
+		using index_type = decltype(std::declval<Buffer>().capacity());
+		auto buffer = Buffer(static_cast<index_type>(capacity));
+		const auto batch_size = capacity / 2;
+		auto batch = std::vector<T>();
+		for(auto i = usize(0); i < batch_size; ++i) {
+			batch.push_back(make_value(i));
+		}
+		auto destination = std::vector<T>(batch_size);
+		// start part way through the storage, so the batches wrap around
+		for(auto i = usize(0); i < capacity / 3; ++i) {
+			buffer.push_back(batch[0]);
+			std::ignore = buffer.pop_front();
+		}
+
+		const auto element_wise = time_per_element(iterations, batch_size, [&]() {
+			for(const auto& value : batch) {
+				buffer.push_back(value);
+			}
+			for(auto& value : destination) {
+				if constexpr(Type == hyperion::RingBufferType::ThreadSafe) {
+					value = buffer.pop_front().unwrap();
+				}
+				else {
+					value = buffer.pop_front();
+				}
+			}
+			return static_cast<u64>(destination.size());
+		});
+		const auto bulk = time_per_element(iterations, batch_size, [&]() {
+			buffer.push_back_n(hyperion::Span<const T>::make_span(batch.data(), batch.size()));
+			return static_cast<u64>(buffer.pop_front_n(
+				hyperion::Span<T>::make_span(destination.data(), destination.size())));
+		});
+
+		fmt::print("{:<24} batch {:<8} push_back/pop_front {:.3f}ns/element  "
+				   "push_back_n/pop_front_n {:.3f}ns/element\n",
+				   name,
+				   batch_size,
+				   element_wise,
+				   bulk);
+	}
+
+	template<hyperion::RingBufferType Type>
+	auto benchmark_allocations(std::string_view name, usize capacity, u64 iterations) -> void {
+		using Buffer = hyperion::RingBuffer<u64, Type>;
+		using index_type = decltype(std::declval<Buffer>().capacity());
+		auto buffer = Buffer(static_cast<index_type>(capacity));
+
+		const auto allocations_before = num_allocations.load(std::memory_order_relaxed);
+		const auto pushed_and_popped = time_per_element(iterations, capacity, [&]() {
+			auto sum = u64(0);
+			for(auto i = u64(0); i < capacity; ++i) {
+				buffer.push_back(i);
+			}
+			for(auto i = usize(0); i < capacity; ++i) {
+				if constexpr(Type == hyperion::RingBufferType::ThreadSafe) {
+					sum += buffer.pop_front().unwrap();
+				}
+				else {
+					sum += buffer.pop_front();
+				}
+			}
+			return sum;
+		});
+		const auto allocations
+			= num_allocations.load(std::memory_order_relaxed) - allocations_before;
+
+		fmt::print("{:<24} capacity {:<8} push_back/pop_front {:.3f}ns/element  "
+				   "{:.3f} allocations/element\n",
+				   name,
+				   capacity,
+				   pushed_and_popped,
+				   static_cast<double>(allocations)
+					   / static_cast<double>(iterations * static_cast<u64>(capacity)));
+	}
+
+	/// @brief Owns a buffer, like a log message, so default constructing one allocates
+	struct Message {
+		std::string payload = std::string(256, ' '); // NOLINT
+	};
+
+	template<hyperion::RingBufferType Type>
+	auto benchmark_construction(std::string_view name, usize capacity, u64 iterations) -> void {
+		using Buffer = hyperion::RingBuffer<Message, Type>;
+		using index_type = decltype(std::declval<Buffer>().capacity());
+		const auto constructed = time_per_element(iterations, capacity, [capacity]() {
+			const auto buffer = Buffer(static_cast<index_type>(capacity));
+			return static_cast<u64>(buffer.capacity());
+		});
+
+		fmt::print("{:<24} capacity {:<8} create and destroy {:.3f}ns/slot\n",
+				   name,
+				   capacity,
+				   constructed);
+	}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+	const auto args = std::vector<std::string_view>(argv + 1, argv + argc); // NOLINT
+	const auto capacity = static_cast<usize>(args.size() > 0 ? parse(args[0], 4096) : 4096);
+	const auto iterations = args.size() > 1 ? parse(args[1], 10000) : 10000;
+
+	benchmark<hyperion::RingBufferCapacity::Exact>("Exact", capacity, iterations);
+	benchmark<hyperion::RingBufferCapacity::PowerOfTwo>("PowerOfTwo", capacity, iterations);
+
+	const auto make_u64 = [](usize i) { return static_cast<u64>(i); };
+	const auto make_string = [](usize i) {
+		// long enough to need an allocation
+		return std::string("a string that is too long for the small string optimization ")
+			   + std::to_string(i);
+	};
+	benchmark_bulk<u64, hyperion::RingBufferType::NotThreadSafe>("u64",
+																 capacity,
+																 iterations,
+																 make_u64);
+	benchmark_bulk<std::string, hyperion::RingBufferType::NotThreadSafe>("std::string",
+																		 capacity,
+																		 iterations,
+																		 make_string);
+	benchmark_bulk<u64, hyperion::RingBufferType::ThreadSafe>("u64 (ThreadSafe)",
+															  capacity,
+															  iterations,
+															  make_u64);
+	benchmark_bulk<std::string, hyperion::RingBufferType::ThreadSafe>("std::string (ThreadSafe)",
+																	  capacity,
+																	  iterations,
+																	  make_string);
+
+	benchmark_allocations<hyperion::RingBufferType::NotThreadSafe>("u64", capacity, iterations);
+	benchmark_allocations<hyperion::RingBufferType::ThreadSafe>("u64 (ThreadSafe)",
+																capacity,
+																iterations);
+
+	const auto construction_iterations = std::max(iterations / 100, u64(1));
+	benchmark_construction<hyperion::RingBufferType::NotThreadSafe>("Message",
+																	capacity,
+																	construction_iterations);
+	benchmark_construction<hyperion::RingBufferType::ThreadSafe>("Message (ThreadSafe)",
+																 capacity,
+																 construction_iterations);
+	return 0;
+}